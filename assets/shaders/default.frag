@@ -14,6 +14,17 @@ uniform float tiling;
 // ink
 uniform sampler2D inkMap;
 uniform int useInk;
+uniform int inkFormat;       // 0: RGBA8 (sC), 1: RG8 (R:  x л\v, G: л\v), 2: R8 (s / 3)
+uniform vec3 teamColors[3];  //  1~3 C
+uniform vec2 inkUVScale;     //  uv (Haϼe׬ 1) -> K 0~1AaOU観 surface atlas  y < 1
+
+// }aϡGinkMap O魶 atlasAinkPageTable OCb atlas m (0 = S)
+uniform int inkSparse;
+uniform usampler2D inkPageTable;
+uniform vec2 inkMapSize;     // ޿aϤjp (texel)
+uniform int inkPageSize;
+uniform int inkPageGutter;
+uniform int inkAtlasPagesX;
 
 // lighting
 uniform vec3 viewPos;
@@ -21,6 +32,53 @@ vec3 lightDir = normalize(vec3(0.5, 0.8, 0.3));
 vec3 lightColor = vec3(1.0, 0.95, 0.9);
 uniform float alpha = 1.0;
 
+// ̷ inkFormat ѽX (C, л\v)
+vec4 DecodeInk(vec2 uv) {
+    if (inkFormat == 1) {
+        // R wgWл\vAuʤᰣ^ӴNO (0 ~ 1  1 ~ 3)
+        vec2 ink = texture(inkMap, uv).rg;
+        if (ink.g < 0.001) return vec4(0.0);
+        float index = clamp(ink.r / ink.g, 0.0, 1.0) * 2.0;
+        int i0 = int(floor(index));
+        vec3 color = mix(teamColors[i0], teamColors[min(i0 + 1, 2)], fract(index));
+        return vec4(color, ink.g);
+    }
+    if (inkFormat == 2) {
+        // sઽA| texel U۸ѽXۤvu
+        vec4 raw = textureGather(inkMap, uv, 0);
+        vec2 f = fract(uv * vec2(textureSize(inkMap, 0)) - 0.5);
+        vec4 weights = vec4((1.0 - f.x) * f.y, f.x * f.y, f.x * (1.0 - f.y), (1.0 - f.x) * (1.0 - f.y));
+
+        vec3 color = vec3(0.0);
+        float coverage = 0.0;
+        for (int i = 0; i < 4; i++) {
+            int team = int(round(raw[i] * 3.0));
+            if (team == 0) continue;
+            color += teamColors[team - 1] * weights[i];
+            coverage += weights[i];
+        }
+        if (coverage < 0.001) return vec4(0.0);
+        return vec4(color / coverage, coverage);
+    }
+    return texture(inkMap, uv);
+}
+
+// ޿aϪ uv  atlas WAѽXF|P gutterAuʤ|ŪO
+vec4 SampleInk(vec2 uv) {
+    if (inkSparse == 0) return DecodeInk(uv);
+
+    vec2 texel = clamp(uv, 0.0, 1.0) * inkMapSize;
+    ivec2 page = min(ivec2(texel) / inkPageSize, textureSize(inkPageTable, 0) - 1);
+    int slot = int(texelFetch(inkPageTable, page, 0).r);
+    if (slot == 0) return vec4(0.0);
+    slot -= 1;
+
+    int stride = inkPageSize + 2 * inkPageGutter;
+    vec2 origin = vec2(ivec2(slot % inkAtlasPagesX, slot / inkAtlasPagesX) * stride + inkPageGutter);
+    vec2 atlasTexel = origin + texel - vec2(page * inkPageSize);
+    return DecodeInk(atlasTexel / vec2(textureSize(inkMap, 0)));
+}
+
 void main() {
     vec4 baseColor = vec4(objectColor, 1.0);
     
@@ -34,7 +92,7 @@ void main() {
     float roughness = 0.8; // w]W (0=, 1=W)
 
     if (useInk == 1) {
-        vec4 inkSample = texture(inkMap, TexCoord); //  tiling
+        vec4 inkSample = SampleInk(TexCoord * inkUVScale); //  tiling
         inkFactor = inkSample.a;
         baseColor.rgb = mix(baseColor.rgb, inkSample.rgb, inkFactor);
         roughness = mix(0.8, 0.1, inkFactor); 
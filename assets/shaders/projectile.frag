@@ -0,0 +1,26 @@
+#version 450 core
+out vec4 FragColor;
+
+in vec3 FragPos;
+in vec3 Normal;
+in vec3 Color;
+
+// lighting, same as an untextured object in default.frag
+uniform vec3 viewPos;
+vec3 lightDir = normalize(vec3(0.5, 0.8, 0.3));
+vec3 lightColor = vec3(1.0, 0.95, 0.9);
+
+void main() {
+    vec3 normal = normalize(Normal);
+    float roughness = 0.8;
+
+    // Blinn-Phong
+    vec3 ambient = 0.4 * lightColor;
+    vec3 diffuse = max(dot(normal, lightDir), 0.0) * lightColor;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(normal, halfwayDir), 0.0), (1.0 - roughness) * 64.0);
+    vec3 specular = vec3(1.0) * spec * (1.0 - roughness);
+
+    FragColor = vec4((ambient + diffuse) * Color + specular, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#version 450 core
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec3 aNormal;
+
+// per-instance (ProjectileRenderer::InstanceData)
+layout (location = 3) in vec3 aOffset;
+layout (location = 4) in float aScale;   // diameter before stretching
+layout (location = 5) in vec3 aVelocity;
+layout (location = 6) in vec3 aColor;
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec3 Color;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform float stretchPerSpeed; // ProjectileSystem::STRETCH_PER_SPEED
+
+void main() {
+    // squash and stretch along the velocity: longer forward, thinner across (same as ProjectileSystem::GetWidth)
+    float speed = length(aVelocity);
+    float stretch = 1.0 + speed * stretchPerSpeed;
+    float width = aScale * inversesqrt(stretch);
+    vec3 size = vec3(width, width, aScale * stretch);
+
+    // orthonormal basis with z along the velocity
+    vec3 forward = (speed > 0.1) ? aVelocity / speed : vec3(0.0, 0.0, 1.0);
+    vec3 up = (abs(forward.y) < 0.99) ? vec3(0.0, 1.0, 0.0) : vec3(1.0, 0.0, 0.0);
+    vec3 right = normalize(cross(up, forward));
+    up = cross(forward, right);
+    mat3 basis = mat3(right, up, forward);
+
+    FragPos = aOffset + basis * (aPos * size);
+    Normal = basis * (aNormal / size); // inverse transpose of basis * diag(size)
+    Color = aColor;
+    gl_Position = projection * view * vec4(FragPos, 1.0);
+}
\ No newline at end of file
@@ -2,17 +2,41 @@
 out vec4 FragColor;
 
 in vec2 TexCoords;
+in vec3 PaintColor;
+in vec2 ShapeCoord;
+flat in vec3 ShapeParams;
+in vec2 MapUV;
+flat in vec4 ClipRect;
+in vec2 MaskCoord;
+flat in vec2 MaskParams;
 
-uniform sampler2D splatTexture;
-uniform vec3 paintColor;
+// 1 bit per texel, rows of ceil(size / 32) words (SplatStampLibrary)
+uniform usamplerBuffer stampMasks;
 
 void main()
 {
-    vec4 texColor = texture(splatTexture, TexCoords);
-    float shapeAlpha = texColor.a;
+    // stay inside the surface this stamp belongs to (floor or one atlas face)
+    if (any(lessThan(MapUV, ClipRect.xy)) || any(greaterThanEqual(MapUV, ClipRect.zw))) {
+        discard;
+    }
+
+    if (ShapeParams.x > 0.5) {
+        // capsule: distance to the center segment
+        vec2 q = vec2(max(abs(ShapeCoord.x) - ShapeParams.y, 0.0), ShapeCoord.y);
+        if (dot(q, q) > ShapeParams.z * ShapeParams.z) {
+            discard;
+        }
+        FragColor = vec4(PaintColor, 1.0);
+        return;
+    }
 
-    if (shapeAlpha < 0.5) {
-        discard; 
+    // splat: same mask bits the CPU coverage is filled from
+    int size = int(MaskParams.x);
+    ivec2 m = clamp(ivec2(floor(MaskCoord)), ivec2(0), ivec2(size - 1));
+    int wordsPerRow = (size + 31) / 32;
+    uint word = texelFetch(stampMasks, int(MaskParams.y) + m.y * wordsPerRow + m.x / 32).r;
+    if (((word >> uint(m.x % 32)) & 1u) == 0u) {
+        discard;
     }
-    FragColor = vec4(paintColor, 1.0); 
+    FragColor = vec4(PaintColor, 1.0);
 }
\ No newline at end of file
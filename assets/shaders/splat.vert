@@ -2,12 +2,63 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoord; 
 
-out vec2 TexCoords;
+// per-instance: xy = uv (0~1), z = size, w = rotation (radians)
+layout (location = 2) in vec4 aStamp;
+layout (location = 3) in vec3 aColor;
+// per-instance: x = stroke half length (NDC), y = shape (0 = splat mask, 1 = capsule)
+layout (location = 4) in vec2 aStroke;
+// per-instance: uv rect (x0, y0, x1, y1) the stamp may write to
+layout (location = 5) in vec4 aClip;
+// per-instance (splat mask): xy = lower-left texel, z = size in texels, w = first word in stampMasks
+layout (location = 6) in vec4 aMask;
+
+// uv is measured in map widths on both axes; this maps it to 0~1 texture space
+uniform vec2 uvScale;
+// ink map size in texels
+uniform vec2 mapSize;
 
-uniform mat4 model;
+out vec2 TexCoords;
+out vec3 PaintColor;
+out vec2 ShapeCoord;
+flat out vec3 ShapeParams; // x = shape, y = half length, z = radius
+out vec2 MapUV;
+flat out vec4 ClipRect;
+out vec2 MaskCoord;       // texel position inside the mask square
+flat out vec2 MaskParams; // x = size in texels, y = first word
 
 void main()
 {
-    gl_Position = model * vec4(aPos, 1.0);
+    ClipRect = aClip;
     TexCoords = aTexCoord;
+    PaintColor = aColor;
+    ShapeParams = vec3(aStroke.y, aStroke.x, aStamp.z);
+    MaskParams = aMask.zw;
+
+    if (aStroke.y < 0.5) {
+        // splat: the quad covers the mask square exactly, on texel boundaries,
+        // so every texel center it rasterizes is one the CPU coverage fills too
+        MaskCoord = (aPos.xy * 0.5 + 0.5) * aMask.z;
+        ShapeCoord = vec2(0.0);
+        vec2 texel = aMask.xy + MaskCoord;
+        MapUV = texel / mapSize.x;
+        gl_Position = vec4(texel / mapSize * 2.0 - 1.0, 0.0, 1.0);
+        return;
+    }
+
+    // scale -> rotate -> translate to uv (NDC)
+    // capsules stretch along x by the segment half length; the quad is one texel
+    // larger than the shape so texel centers exactly on the edge still reach the
+    // fragment shader (the CPU raster counts them as inside)
+    float margin = 2.0 / mapSize.x;
+    vec2 p = aPos.xy * vec2(aStamp.z + aStroke.x + margin, aStamp.z + margin);
+    ShapeCoord = p;
+    MaskCoord = vec2(0.0);
+
+    float c = cos(aStamp.w);
+    float s = sin(aStamp.w);
+    p = vec2(c * p.x - s * p.y, s * p.x + c * p.y);
+    p += aStamp.xy * 2.0;
+
+    MapUV = p * 0.5;
+    gl_Position = vec4(p * uvScale - 1.0, 0.0, 1.0);
 }
\ No newline at end of file
@@ -16,6 +16,21 @@ struct KillLog {
     float timer;    // ܮɶ
 };
 
+// eӤHa
+struct PlayerTurf {
+    int playerID;
+    int teamID;  // 1=red, 2=green (0 = )
+    int points;  // an (褽)
+};
+
+// paϤWaаO
+struct MinimapMarker {
+    glm::vec2 uv;  // aϪ uv
+    int teamID;    // 1=red, 2=green
+    bool isSelf;
+    bool isDead;
+};
+
 class HUD : public Component {
     unsigned int VAO, VBO;
     Shader* uiShader;
@@ -100,6 +115,36 @@ public:
         DrawSpecialGauge(specialPercent);
     }
 
+    // Upa (texture  0 CO uv.v = 0A]NOeU)
+    void DrawMinimap(unsigned int texture, const std::vector<MinimapMarker>& markers) {
+        const float size = 180.0f;
+        const float pad = 10.0f;
+        ImVec2 p = ImVec2(pad, screenHeight - size - pad);
+        ImGui::SetNextWindowPos(p);
+        ImGui::SetNextWindowSize(ImVec2(size, size));
+
+        ImGui::Begin("Minimap", nullptr,
+            ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground |
+            ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing);
+
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        ImVec2 q = ImVec2(p.x + size, p.y + size);
+        drawList->AddImage((intptr_t)texture, p, q, ImVec2(0, 1), ImVec2(1, 0));
+        drawList->AddRect(p, q, IM_COL32(255, 255, 255, 160), 0.0f, 0, 2.0f);
+
+        for (const auto& m : markers) {
+            ImVec2 c = ImVec2(p.x + m.uv.x * size, p.y + (1.0f - m.uv.y) * size);
+            ImU32 color = (m.teamID == 1) ? IM_COL32(255, 60, 60, 255) : IM_COL32(60, 255, 60, 255);
+            if (m.isDead) color = IM_COL32(90, 90, 90, 200);
+
+            float radius = m.isSelf ? 6.0f : 4.5f;
+            drawList->AddCircleFilled(c, radius, color);
+            drawList->AddCircle(c, radius, m.isSelf ? IM_COL32(255, 255, 255, 255) : IM_COL32(0, 0, 0, 200), 0, m.isSelf ? 2.0f : 1.0f);
+        }
+
+        ImGui::End();
+    }
+
     void ConsumeInk(float amount) {
         currentInk -= amount;
         if (currentInk < 0) currentInk = 0;
@@ -110,25 +155,29 @@ public:
         if (currentInk > 1.0f) currentInk = 1.0f;
     }
 
-    // [J@T
-    void AddKillLog(int killerID, int victimID, int kTeam, int vTeam) {
+    // ²ഫ ID r
+    static std::string PlayerName(int playerID) {
+        return (playerID == 0) ? "Host" : (playerID == 100 ? "AI" : "P" + std::to_string(playerID));
+    }
+
+    // [J@T (killerTurf >= 0 ɦb̫᭱ܥثea)
+    void AddKillLog(int killerID, int victimID, int kTeam, int vTeam, int killerTurf = -1) {
         KillLog log;
         log.killerTeam = kTeam;
         log.timer = 4.0f; //  4 
 
-        // ²ഫ ID r
-        std::string kName = (killerID == 0) ? "Host" : (killerID == 100 ? "AI" : "P" + std::to_string(killerID));
-        std::string vName = (victimID == 0) ? "Host" : (victimID == 100 ? "AI" : "P" + std::to_string(victimID));
+        std::string kName = PlayerName(killerID);
+        if (killerTurf >= 0) kName += " (" + std::to_string(killerTurf) + "p)";
 
         // 榡: "Killer -> Victim"
-        log.text = kName + " > " + vName;
+        log.text = kName + " > " + PlayerName(victimID);
 
         killLogs.push_back(log);
         if (killLogs.size() > 5) killLogs.pop_front(); // ̦h 5 
     }
 
     // øse
-    void DrawResultScreen(float score1, float score2, int myTeam, float animTime) {
+    void DrawResultScreen(float score1, float score2, int myTeam, float animTime, const std::vector<PlayerTurf>& playerTurf = {}) {
 
         // 1. "FINISH!" r (ʱ)
         // ue 2 ܡAΪ̤@ܦܤp
@@ -200,6 +249,21 @@ public:
 
             ImGui::End();
         }
+
+        // 4. ӤHa (C)
+        if (animTime > 3.0f && !playerTurf.empty()) {
+            ImGui::SetNextWindowPos(ImVec2(screenWidth - 220, 80));
+            ImGui::SetNextWindowSize(ImVec2(200, 0));
+            ImGui::Begin("PlayerTurf", nullptr, ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoBackground);
+            ImGui::SetWindowFontScale(1.5f);
+
+            for (const auto& entry : playerTurf) {
+                ImVec4 color = (entry.teamID == 1) ? ImVec4(1, 0.3f, 0.3f, 1) : (entry.teamID == 2) ? ImVec4(0.3f, 1, 0.3f, 1) : ImVec4(1, 1, 1, 1);
+                ImGui::TextColored(color, "%-6s %5dp", PlayerName(entry.playerID).c_str(), entry.points);
+            }
+
+            ImGui::End();
+        }
     }
 
     void ShowHitMarker() {
@@ -87,43 +87,46 @@ public:
     static std::shared_ptr<Mesh> GetSphere() {
         static std::shared_ptr<Mesh> sphereMesh = nullptr;
         if (!sphereMesh) {
-            std::vector<Vertex> vertices;
-            std::vector<unsigned int> indices;
-
-            const unsigned int X_SEGMENTS = 16; // K (VVAįV)
-            const unsigned int Y_SEGMENTS = 16;
-            const float PI = 3.14159265359f;
-
-            for (unsigned int y = 0; y <= Y_SEGMENTS; ++y) {
-                for (unsigned int x = 0; x <= X_SEGMENTS; ++x) {
-                    float xSegment = (float)x / (float)X_SEGMENTS;
-                    float ySegment = (float)y / (float)Y_SEGMENTS;
-                    float xPos = std::cos(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
-                    float yPos = std::cos(ySegment * PI);
-                    float zPos = std::sin(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
-
-                    Vertex v;
-                    v.Position = glm::vec3(xPos, yPos, zPos) * 0.5f; // b| 0.5A| 1.0
-                    v.TexCoords = glm::vec2(xSegment, ySegment);
-                    v.Normal = glm::normalize(glm::vec3(xPos, yPos, zPos));
-                    vertices.push_back(v);
-                }
+            sphereMesh = CreateSphere(16, 16); // K (VVAįV)
+        }
+        return sphereMesh;
+    }
+
+    // | 1.0  UV yACIsإ߷s Mesh (nۤv instance ݩʮɥΡA|ʨ@Ϊ GetSphere)
+    static std::shared_ptr<Mesh> CreateSphere(unsigned int X_SEGMENTS, unsigned int Y_SEGMENTS) {
+        std::vector<Vertex> vertices;
+        std::vector<unsigned int> indices;
+
+        const float PI = 3.14159265359f;
+
+        for (unsigned int y = 0; y <= Y_SEGMENTS; ++y) {
+            for (unsigned int x = 0; x <= X_SEGMENTS; ++x) {
+                float xSegment = (float)x / (float)X_SEGMENTS;
+                float ySegment = (float)y / (float)Y_SEGMENTS;
+                float xPos = std::cos(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
+                float yPos = std::cos(ySegment * PI);
+                float zPos = std::sin(xSegment * 2.0f * PI) * std::sin(ySegment * PI);
+
+                Vertex v;
+                v.Position = glm::vec3(xPos, yPos, zPos) * 0.5f; // b| 0.5A| 1.0
+                v.TexCoords = glm::vec2(xSegment, ySegment);
+                v.Normal = glm::normalize(glm::vec3(xPos, yPos, zPos));
+                vertices.push_back(v);
             }
+        }
 
-            for (unsigned int y = 0; y < Y_SEGMENTS; ++y) {
-                for (unsigned int x = 0; x < X_SEGMENTS; ++x) {
-                    indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-                    indices.push_back(y * (X_SEGMENTS + 1) + x);
-                    indices.push_back(y * (X_SEGMENTS + 1) + x + 1);
+        for (unsigned int y = 0; y < Y_SEGMENTS; ++y) {
+            for (unsigned int x = 0; x < X_SEGMENTS; ++x) {
+                indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
+                indices.push_back(y * (X_SEGMENTS + 1) + x);
+                indices.push_back(y * (X_SEGMENTS + 1) + x + 1);
 
-                    indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
-                    indices.push_back(y * (X_SEGMENTS + 1) + x + 1);
-                    indices.push_back((y + 1) * (X_SEGMENTS + 1) + x + 1);
-                }
+                indices.push_back((y + 1) * (X_SEGMENTS + 1) + x);
+                indices.push_back(y * (X_SEGMENTS + 1) + x + 1);
+                indices.push_back((y + 1) * (X_SEGMENTS + 1) + x + 1);
             }
-            sphereMesh = std::make_shared<Mesh>(vertices, indices);
         }
-        return sphereMesh;
+        return std::make_shared<Mesh>(vertices, indices);
     }
 };
 
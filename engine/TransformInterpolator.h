@@ -0,0 +1,63 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <glm/glm.hpp>
+#include "Transform.h"
+
+// TwBeGC tick }le Capture OU transformAee Apply 
+// W@ tick M̷s tick m (alpha = 0 ~ 1)Ae Restore ^A
+// ub Apply M Restore  transformAûݨ쪺O tick G
+// usСGCapture U@ Clear eAQOU󤣯R (R󪺦an Clear)
+class TransformInterpolator {
+public:
+    // @ tick ʶWLoӶZN (͡Bǰe)Aesm
+    static constexpr float SNAP_DISTANCE = 5.0f;
+
+    // C tick }leGMW@ tick 
+    void Clear() { entries.clear(); }
+
+    // withRotation = falseGum (Ҧp۾A۷ƹƥ󨫡Ab tick )
+    void Capture(Transform* t, bool withRotation = true) {
+        if (!t) return;
+        entries.push_back({ t, t->position, t->rotation, glm::vec3(0.0f), glm::vec3(0.0f), withRotation });
+    }
+
+    void Apply(float alpha) {
+        for (Entry& e : entries) {
+            e.currentPosition = e.transform->position;
+            e.currentRotation = e.transform->rotation;
+            if (glm::distance(e.prevPosition, e.currentPosition) > SNAP_DISTANCE) continue;
+            e.transform->position = glm::mix(e.prevPosition, e.currentPosition, alpha);
+            if (e.withRotation) {
+                for (int i = 0; i < 3; i++) {
+                    e.transform->rotation[i] = LerpAngle(e.prevRotation[i], e.currentRotation[i], alpha);
+                }
+            }
+        }
+    }
+
+    void Restore() {
+        for (Entry& e : entries) {
+            e.transform->position = e.currentPosition;
+            e.transform->rotation = e.currentRotation;
+        }
+    }
+
+private:
+    struct Entry {
+        Transform* transform;
+        glm::vec3 prevPosition, prevRotation;
+        glm::vec3 currentPosition, currentRotation; // Apply ɼȦsARestore ^
+        bool withRotation;
+    };
+
+    std::vector<Entry> entries;
+
+    //  () ̵u@A359 -> 1 |¶@j
+    static float LerpAngle(float a, float b, float t) {
+        float d = std::fmod(b - a, 360.0f);
+        if (d > 180.0f) d -= 360.0f;
+        else if (d < -180.0f) d += 360.0f;
+        return a + d * t;
+    }
+};
\ No newline at end of file
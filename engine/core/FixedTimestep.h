@@ -0,0 +1,45 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+// TwBGzBluBgtBeXWvΦP@өTw dtAesvL
+// C@VgLuɶi accumulatorAC@ step ]@ tick
+// ѤU@ step NOe (GetAlpha)GeebW@ tick M̷s tick 
+//
+// @V̦hl maxTicksPerFrame  tick (קK spiral of deathGӺC -> nlh tick -> C)
+// WLɶᱼACܦCʧ@ӤOd
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float step = 1.0f / 60.0f, int maxTicksPerFrame = 5)
+        : step(step), maxTicksPerFrame(maxTicksPerFrame) {
+    }
+
+    // io@VgLɶA^ǳo@Vn]X tick (C tick  dt = GetStep())
+    int Advance(float frameTime) {
+        accumulator += std::max(0.0f, frameTime);
+        int ticks = (int)(accumulator / step);
+        if (ticks > maxTicksPerFrame) {
+            droppedTicks += (uint64_t)(ticks - maxTicksPerFrame);
+            ticks = maxTicksPerFrame;
+            accumulator = 0.0f;
+        }
+        else {
+            accumulator -= ticks * step;
+        }
+        tickCount += (uint64_t)ticks;
+        return ticks;
+    }
+
+    float GetStep() const { return step; }
+    float GetAlpha() const { return std::min(accumulator / step, 1.0f); }
+    uint64_t GetTickCount() const { return tickCount; }
+    double GetSimTime() const { return tickCount * (double)step; }
+    uint64_t GetDroppedTicks() const { return droppedTicks; } // lWӥᱼ tick 
+
+private:
+    float step;
+    int maxTicksPerFrame;
+    float accumulator = 0.0f;
+    uint64_t tickCount = 0;
+    uint64_t droppedTicks = 0;
+};
\ No newline at end of file
@@ -5,7 +5,7 @@ void mouse_callback_proxy(GLFWwindow* window, double xpos, double ypos) {
     // pGA Camera ݭnoƾڡAiHbooAΪ Camera h Input::GetMousePosition()
 }
 
-Window::Window(int width, int height, const std::string& title)
+Window::Window(int width, int height, const std::string& title, bool visible)
     : m_Width(width), m_Height(height), m_Title(title)
 {
     Logger::Log("Initializing Window...");
@@ -18,6 +18,8 @@ Window::Window(int width, int height, const std::string& title)
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    // headless ҦG٬On GL context (O GPU )AuOܵ
+    glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
 
     m_Window = glfwCreateWindow(width, height, title.c_str(), NULL, NULL);
     if (m_Window == NULL) {
@@ -7,7 +7,7 @@
 
 class Window {
 public:
-    Window(int width, int height, const std::string& title);
+    Window(int width, int height, const std::string& title, bool visible = true);
     ~Window();
 
     bool ShouldClose();
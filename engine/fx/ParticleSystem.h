@@ -150,7 +150,7 @@ private:
 
         // Instance VBO: Ҹ (Offset, Color, Scale)
         glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
-        // wt@IŶAϥ| glBufferData л\
+        // wt@IŶA glBufferData |stm
         glBufferData(GL_ARRAY_BUFFER, 1000 * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
 
         // ]w Instance Attribute (m 1, 2, 3)
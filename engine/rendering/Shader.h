@@ -13,6 +13,9 @@ public:
     // غclGŪ|BsĶBs
     Shader(const std::string& vertexPath, const std::string& fragmentPath);
 
+    // غclGu Compute Shader  Program
+    explicit Shader(const std::string& computePath);
+
     // ѺclG OpenGL 귽 (RAII)
     ~Shader();
 
@@ -31,6 +34,9 @@ private:
     // ˬdsĶ~U禡
     void CheckCompileErrors(unsigned int shader, std::string type);
 
+    // Ū shader lXɮ
+    static std::string ReadFile(const std::string& path);
+
     // Uniform ֨t
     mutable std::unordered_map<std::string, int> m_UniformLocationCache;
 
@@ -11,9 +11,11 @@ public:
 
     virtual void OnExit() = 0;
 
+    // CөTw tick Is@ (dt TwO@ tick )
     virtual void Update(float dt) = 0;
 
-    virtual void Render() = 0;
+    // C@VIs@Falpha (0 ~ 1) = o@VbW@ tick M̷s tick m
+    virtual void Render(float alpha) = 0;
 
     virtual void DrawUI() = 0;
 
@@ -25,9 +25,9 @@ void SceneManager::Update(float dt) {
     }
 }
 
-void SceneManager::Render() {
+void SceneManager::Render(float alpha) {
     if (m_CurrentScene) {
-        m_CurrentScene->Render();
+        m_CurrentScene->Render(alpha);
     }
 }
 
@@ -10,7 +10,7 @@ public:
 
     // Forwarding
     void Update(float dt);
-    void Render();
+    void Render(float alpha);
     void DrawUI();
     void HandlePacket(const ReceivedPacket& pkt);
 
@@ -6,6 +6,8 @@
 #include "SlosherWeapon.h"
 #include "../components/MeshRenderer.h"
 #include "../components/Health.h"
+#include "../splat/SplatMap.h"
+#include "../splat/SplatPhysics.h"
 #include <glm/glm.hpp>
 #include <cstdlib>
 
@@ -14,6 +16,8 @@ public:
     // --- ݩ ---
     float moveSpeed = 3.0f;
     float mapLimit = 18.0f;
+    float floorSize = 80.0f;
+    float lookAhead = 4.0f;    // Vɬݫeh
 
     // state
     float changeDirTime = 2.0f;
@@ -22,6 +26,7 @@ public:
 
     // reference
     Weapon* weapon = nullptr;;
+    SplatMap* splatMapRef = nullptr;
     GameObject* visualBody;
     GameObject* shadow;
 
@@ -85,9 +90,28 @@ public:
 
 private:
     void RandomizeDir() {
+        currentDir = RandomDir();
+        if (!splatMapRef) return;
+
+        // hXӤVADeۤv̻ (uh٨Sa)
+        float best = -1.0f;
+        for (int i = 0; i < 4; i++) {
+            glm::vec3 dir = (i == 0) ? currentDir : RandomDir();
+            auto hit = SplatPhysics::WorldToUV(transform->position + dir * lookAhead, glm::vec3(0.0f), floorSize, floorSize);
+            if (!hit.hit) continue;
+
+            float dist = splatMapRef->DistanceToInk(hit.uv.x, hit.uv.y, teamID);
+            if (dist > best) {
+                best = dist;
+                currentDir = dir;
+            }
+        }
+    }
+
+    glm::vec3 RandomDir() {
         float x = (float)(rand() % 100) - 50;
         float z = (float)(rand() % 100) - 50;
-        currentDir = glm::normalize(glm::vec3(x, 0, z));
+        return glm::normalize(glm::vec3(x, 0, z));
     }
 
     void CheckBounds(float dt) {
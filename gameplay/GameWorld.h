@@ -6,10 +6,12 @@
 #include <memory>
 #include <algorithm>
 #include "../engine/fx/ParticleSystem.h"
+#include "../engine/TransformInterpolator.h"
 #include "../scene/Level.h"
 #include "../splat/SplatMap.h"
 #include "../splat/SplatPainter.h"
 #include "../splat/SplatPhysics.h"
+#include "../splat/SplatMinimap.h"
 #include "../splat/SplatRenderer.h"
 #include "ShooterWeapon.h"
 #include "BrushWeapon.h"
@@ -17,11 +19,15 @@
 #include "Player.h"
 #include "Enemy.h"
 #include "RemotePlayer.h"
-#include "Projectile.h"
+#include "ProjectileSystem.h"
+#include "ProjectileRenderer.h"
+#include "SpatialGrid.h"
+#include "SweptCollision.h"
 #include "../components/Scoreboard.h"
 #include "../components/Health.h"
 #include "../network/NetworkManager.h"
 #include "../network/NetworkProtocol.h"
+#include "../network/SplatReplicator.h"
 
 enum class WorldState {
     PLAYING,
@@ -34,20 +40,40 @@ public:
     std::unique_ptr<Level> level;
     std::unique_ptr<SplatMap> splatMap;
     std::unique_ptr<SplatPainter> painter;
+    std::unique_ptr<SplatMinimap> minimap;
     std::unique_ptr<ParticleSystem> particleSystem;
+    std::unique_ptr<ProjectileRenderer> projectileRenderer;
+    std::unique_ptr<SplatReplicator> splatReplicator; // suɤ~إ
     Scoreboard* scoreboardRef = nullptr;
     HUD* hudRef = nullptr;
 
     // --- 骫 ---
     std::unique_ptr<Player> localPlayer;
     std::unique_ptr<Enemy> enemyAI;
-    std::vector<std::unique_ptr<Projectile>> projectiles;
+    ProjectileSystem projectiles;
+
+    // RPwΪl (C@Vluseؤ@)AsOӨ骺]y
+    SpatialGrid<Entity*> entityGrid;
+    std::vector<Entity*> hitCandidates; // dߵGAƨϥ
+    // HPwOߪnG} BODY_HEIGHT ( visualBody @˰)Ab| BODY_RADIUS
+    static constexpr float BODY_HEIGHT = 1.8f;
+    static constexpr float BODY_RADIUS = 0.5f;
+    static constexpr float ENTITY_GRID_SLACK = 1.0f;  // ؤH٥iਫZ (pgbؤeĲo)
+
+    // lud (Level::collision) dߡAindex  projectiles Aluɤ@_ swap and pop
+    std::vector<LevelBVH::SweepQuery> levelSweeps;
+    std::vector<LevelBVH::Hit> levelHits;
+    std::vector<char> floorHits;
 
     // ݪaC
     std::map<int, std::unique_ptr<RemotePlayer>> remotePlayers;
 
-    // PBpɾ
+    // PBpɾ (Tw tick ֥[AC SYNC_INTERVAL e@AlƯdU@)
     float syncTimer = 0.0f;
+    static constexpr float SYNC_INTERVAL = 0.05f;
+    // Ƽs (u Server)A syncTimer @˲֥[Tw tick
+    float scoreTimer = 0.0f;
+    static constexpr float SCORE_SYNC_INTERVAL = 0.5f;
 
     // CAܼ
     WorldState state = WorldState::PLAYING;
@@ -59,12 +85,33 @@ public:
     float finalScoreTeam2 = 0.0f;
     int winningTeam = 0; // 0=, 1=, 2=
 
+    // Uϰ (level->zones) л\v (x = , y = )AServer / C tick s
+    std::vector<glm::vec2> zoneScores;
+
+    // ɪӤHa (ưC)
+    std::vector<PlayerTurf> finalPlayerTurf;
+
+    static constexpr float INK_TEXELS_PER_METER = 12.8f;
+
     void Init(GameObject* mainCamera, HUD* hud, Scoreboard* scoreboard) {
         level = std::make_unique<Level>();
         level->Load();
-        splatMap = std::make_unique<SplatMap>(1024, 1024);
+        // ѪR׸۳ajp (C 12.8 texelA80m a = 1024)A쭶jp
+        // WL 1024 jaε}AuLϰO
+        const int page = SplatCoverage::PAGE_SIZE;
+        int resolution = ((int)std::ceil(level->mapSize * INK_TEXELS_PER_METER) + page - 1) / page * page;
+        // PclƦbaOUAP@iaϡBP@ FBO
+        level->BuildPaintSurfaces(resolution);
+        splatMap = std::make_unique<SplatMap>(resolution, resolution + level->surfaceAtlas.GetRows(), InkFormat::R8, resolution > 1024);
+        splatMap->SetPaintableTexels((int64_t)resolution * resolution + level->surfaceAtlas.GetFaceTexels());
+        splatMap->EnableOwnerTracking(); // eӤHa
+#ifndef NDEBUG
+        splatMap->debugValidateCounters = true;
+#endif
         painter = std::make_unique<SplatPainter>();
+        minimap = std::make_unique<SplatMinimap>(splatMap->width, splatMap->width); // ueaO
         particleSystem = std::make_unique<ParticleSystem>();
+        projectileRenderer = std::make_unique<ProjectileRenderer>();
         scoreboardRef = scoreboard;
         hudRef = hud;
 
@@ -104,25 +151,45 @@ public:
             localPlayer->weapon->inkColor = glm::vec3(1, 0, 0);
             // u Server إ AI (޿誺)
             enemyAI = std::make_unique<Enemy>(glm::vec3(5, 0, 5), 2);
+            enemyAI->splatMapRef = splatMap.get();
         }
         else {
             enemyAI = nullptr;
         }
+        RebuildEntityGrid();
+
+        // aϦPBGClient i Server n@a
+        if (NetworkManager::Instance().IsConnected()) {
+            splatReplicator = std::make_unique<SplatReplicator>(splatMap.get());
+            if (!NetworkManager::Instance().IsServer()) {
+                splatReplicator->RequestFullSync();
+            }
+        }
     }
 
-    // AABB I˴ (]tyb|Pw)
-    bool CheckCollision(GameObject* bullet, GameObject* target) {
-        glm::vec3 posB = bullet->transform->position;
+    // sIGluo@Bq prevB  posBALyHn (|]@BӻNLh)
+    // bulletRadius OluԦ᪺Ib| (ProjectileSystem::GetWidth / 2)At = I쪺m (0 ~ 1)
+    // Hbo@B̪ʩp (luH֫ܦh)
+    bool CheckCollision(const glm::vec3& prevB, const glm::vec3& posB, float bulletRadius, GameObject* target, float& t) {
         glm::vec3 posT = target->transform->position;
 
-        // PwIyLW (]HO۪)
-        glm::vec3 centerT = posT + glm::vec3(0, 1.0f, 0);
-        float bulletRadius = bullet->transform->scale.x * 0.5f;
+        // nbGݦUY@ӥb|Annq}Y
+        glm::vec3 bottom = posT + glm::vec3(0, BODY_RADIUS, 0);
+        glm::vec3 top = posT + glm::vec3(0, BODY_HEIGHT - BODY_RADIUS, 0);
 
-        float dist = glm::distance(posB, centerT);
+        return SweptCollision::SphereVsCapsule(prevB, posB, bulletRadius, bottom, top, BODY_RADIUS, t);
+    }
 
-        // PwZ = Hb| (0.5) + lub|
-        return dist < (0.5f + bulletRadius);
+    // Ҧ ( + AI + ݪa) ilA@V@
+    void RebuildEntityGrid() {
+        entityGrid.Clear();
+        auto add = [&](Entity* e) {
+            if (e) entityGrid.Insert(e, e->transform->position + glm::vec3(0, BODY_HEIGHT * 0.5f, 0), BODY_HEIGHT * 0.5f);
+        };
+        add(localPlayer.get());
+        add(enemyAI.get());
+        for (auto& pair : remotePlayers) add(pair.second.get());
+        entityGrid.Build();
     }
 
     void Update(float dt) {
@@ -167,7 +234,7 @@ public:
             // --- 2. PB (oeA) ---
             if (NetworkManager::Instance().IsConnected()) {
                 syncTimer += dt;
-                if (syncTimer > 0.05f) {
+                if (syncTimer >= SYNC_INTERVAL) {
                     // 1. oeaۤvA
                     PacketPlayerState pkt;
                     pkt.header.type = PacketType::C2S_PLAYER_STATE;
@@ -202,14 +269,13 @@ public:
                         // Client: ǰe Server
                         NetworkManager::Instance().SendToServer(&pkt, sizeof(pkt), false);
                     }
-                    syncTimer = 0.0f;
+                    syncTimer = std::min(syncTimer - SYNC_INTERVAL, SYNC_INTERVAL);
                 }
 
                 // B. ƻPCAPB (CWv: 0.5s = 2Hz)
-                static float scoreTimer = 0.0f;
                 scoreTimer += dt;
 
-                if (scoreTimer > 0.5f) {
+                if (scoreTimer >= SCORE_SYNC_INTERVAL) {
                     // u Server vOs
                     if (NetworkManager::Instance().IsServer()) {
                         // p
@@ -227,7 +293,12 @@ public:
                         // Server a Scoreboard s
                         if (scoreboardRef) scoreboardRef->SetScores(scores.x, scores.y);
                     }
-                    scoreTimer = 0.0f;
+                    scoreTimer = std::min(scoreTimer - SCORE_SYNC_INTERVAL, SCORE_SYNC_INTERVAL);
+                }
+
+                // C. aϮե (Server ̦U Client WeweXܰʪ tile)
+                if (splatReplicator && NetworkManager::Instance().IsServer()) {
+                    splatReplicator->UpdateServer(dt);
                 }
             }
 
@@ -238,8 +309,16 @@ public:
 
             // --- 4. sluzPI ---
             if (particleSystem) particleSystem->Update(dt);
+            RebuildEntityGrid(); // o@VҦHʧF
             UpdateProjectiles(dt);
 
+            // o@VҦ@ei SplatMap
+            if (painter) painter->Flush();
+
+            if (!NetworkManager::Instance().IsConnected() || NetworkManager::Instance().IsServer()) {
+                UpdateZoneScores();
+            }
+
             if (gameTimeRemaining <= 0.0f) {
                 EndGame();
             }
@@ -248,21 +327,39 @@ public:
         else if (state == WorldState::FINISHED) {
             finishTimer -= dt;
             if (localPlayer) localPlayer->velocity = glm::vec3(0);
+
+            // ᦬쪺pgʥ]]neX
+            if (painter) painter->Flush();
         }
     }
 
-    void Render(Shader& shader, Camera* cam) {
+    // C tick }leOU|ʪF (eXӪ)ARender ɦb tick 
+    void CaptureRenderState(TransformInterpolator& interpolator) {
+        auto capture = [&](GameObject* owner, GameObject* body) {
+            if (owner) interpolator.Capture(owner->transform);
+            if (body) interpolator.Capture(body->transform);
+        };
+        if (localPlayer) capture(localPlayer.get(), localPlayer->GetVisualBody());
+        if (enemyAI) capture(enemyAI.get(), enemyAI->GetVisualBody());
+        for (auto& pair : remotePlayers) capture(pair.second.get(), pair.second->GetVisualBody());
+    }
+
+    // alphaGebW@ tick M̷s tick m (luΦۤvW@Ӧm)
+    void Render(Shader& shader, Camera* cam, float alpha = 1.0f) {
+        // 0. paϸWo@V (uWǦܰʪC)
+        if (minimap) minimap->Update(*splatMap);
+
         // 1. eaO (SplatMap)
         SplatRenderer::RenderFloor(shader, level->floor, splatMap.get());
 
-        // 2. ePê (z)
-        shader.SetInt("useInk", 0);
+        // 2. ePê (zAb surface atlas W)
         shader.SetFloat("alpha", 1.0f);
-        for (auto wall : level->walls) wall->Draw(shader);
+        SplatRenderer::RenderSurfaces(shader, level->paintSurfaces, splatMap.get());
 
-        // 3. e
-        for (const auto& p : projectiles) {
-            if (p) p->Draw(shader);
+        // 3. e (luΦۤv shader @eAe^D shader)
+        if (projectileRenderer && cam) {
+            projectileRenderer->Draw(projectiles, cam->GetViewMatrix(), cam->GetProjectionMatrix(), cam->gameObject->transform->position, alpha);
+            shader.Bind();
         }
 
         if (localPlayer->GetVisualBody()) localPlayer->GetVisualBody()->Draw(shader);
@@ -321,33 +418,27 @@ public:
 
     // Τ@åͦlu (]toe)
     void CollectProjectiles(Weapon& weapon) {
+        // P_oZO֪ (lu ownerID |@aaέp)
+        int ownerID = -1; // b
+        if (localPlayer && &weapon == localPlayer->weapon) {
+            ownerID = NetworkManager::Instance().GetMyPlayerID();
+        }
+        else if (enemyAI && &weapon == enemyAI->weapon) {
+            ownerID = 100; // pGO AI ZAID  100
+        }
+
         for (const auto& info : weapon.pendingSpawns) {
             // A. aͦ (ıߧY^X)
             glm::vec3 velocity = info.dir * info.speed;
             velocity.y += 2.0f;
 
-            int myID = NetworkManager::Instance().GetMyPlayerID();
-            auto p = std::make_unique<Projectile>(velocity, info.color, info.team, info.scale, myID);
-            p->transform->position = info.pos;
-            projectiles.push_back(std::move(p));
+            projectiles.Spawn(info.pos, velocity, info.color, info.team, info.scale, ownerID);
 
             // B. PB (qLH)
             if (NetworkManager::Instance().IsConnected()) {
                 PacketShoot pkt;
                 pkt.header.type = PacketType::C2S_SHOOT;
-
-                // P_oZO֪
-                if (weapon.teamID == localPlayer->teamID) {
-                    pkt.playerID = NetworkManager::Instance().GetMyPlayerID();
-                }
-                else if (enemyAI && weapon.teamID == enemyAI->teamID) {
-                    pkt.playerID = 100; // pGO AI ZAID  100
-                }
-                else {
-                    pkt.playerID = -1; // b
-                }
-
-                pkt.playerID = NetworkManager::Instance().GetMyPlayerID();
+                pkt.playerID = ownerID;
                 pkt.origin = info.pos;
                 pkt.direction = info.dir;
                 pkt.speed = info.speed;
@@ -370,6 +461,51 @@ public:
         weapon.pendingSpawns.clear();
     }
 
+    // aثea (aϤWٯd۪nA1  = 1 褽)
+    int GetPlayerTurfPoints(int playerID) const {
+        if (!splatMap || !level) return 0;
+        float texelSize = level->mapSize / splatMap->width;
+        return (int)(splatMap->GetPlayerTexels(playerID) * texelSize * texelSize + 0.5f);
+    }
+
+    // paϤWam
+    void GetMinimapMarkers(std::vector<MinimapMarker>& out) const {
+        out.clear();
+        auto add = [&](const glm::vec3& pos, int team, bool isSelf, bool isDead) {
+            glm::vec2 uv = SplatPhysics::WorldToUVUnbounded(pos, glm::vec3(0), level->mapSize, level->mapSize);
+            out.push_back({ glm::clamp(uv, glm::vec2(0.0f), glm::vec2(1.0f)), team, isSelf, isDead });
+        };
+
+        if (enemyAI) {
+            auto hp = enemyAI->GetComponent<Health>();
+            add(enemyAI->transform->position, enemyAI->teamID, false, hp && hp->isDead);
+        }
+        for (auto& pair : remotePlayers) {
+            auto hp = pair.second->GetComponent<Health>();
+            add(pair.second->transform->position, pair.second->teamID, false, hp && hp->isDead);
+        }
+        // ۤv̫eA\b̤W
+        if (localPlayer) {
+            add(localPlayer->transform->position, localPlayer->teamID, true, localPlayer->state == PlayerState::DEAD);
+        }
+    }
+
+    int GetPlayerTeam(int playerID) const {
+        if (playerID == 100) return enemyAI ? enemyAI->teamID : 2;
+        if (localPlayer && playerID == NetworkManager::Instance().GetMyPlayerID()) return localPlayer->teamID;
+        auto it = remotePlayers.find(playerID);
+        return (it != remotePlayers.end()) ? it->second->teamID : 0;
+    }
+
+    // ϰثeuն (0=/S, 1=, 2=)
+    int GetZoneOwner(int zone) const {
+        if (zone < 0 || zone >= (int)zoneScores.size()) return 0;
+        const glm::vec2& s = zoneScores[zone];
+        if (s.x > s.y) return 1;
+        if (s.y > s.x) return 2;
+        return 0;
+    }
+
     void CleanUp() {
         remotePlayers.clear();
     }
@@ -416,6 +552,12 @@ public:
                 outPkt.header.type = PacketType::S2C_SPECIAL_ATTACK;
                 net.Broadcast(&outPkt, sizeof(outPkt), true, received.fromConnection);
             }
+            else if (received.type == PacketType::C2S_SPLAT_SYNC_REQUEST) {
+                if (splatReplicator) splatReplicator->OnSyncRequest(received.fromConnection);
+            }
+            else if (received.type == PacketType::C2S_SPLAT_TILE_REQUEST) {
+                if (splatReplicator) splatReplicator->OnTileRequest(received.fromConnection, received.data);
+            }
         }
 
 		// B. Common Client & Server Logic
@@ -456,12 +598,21 @@ public:
             auto* pkt = (PacketSpecialLaser*)received.data.data();
             TriggerLaserBeam(pkt->origin, pkt->direction, pkt->teamID, pkt->playerID);
         }
+        else if (received.type == PacketType::S2C_SPLAT_UPDATE) {
+            // ⥻a٦bCeAAM Server eӪ (tile |\)
+            if (painter) painter->Flush();
+            if (splatReplicator) splatReplicator->ApplyPacket(received.data);
+        }
+        else if (received.type == PacketType::S2C_SPLAT_HASH) {
+            if (painter) painter->Flush();
+            if (splatReplicator) splatReplicator->ApplyHashPacket(received.data);
+        }
         else if (received.type == PacketType::S2C_KILL_EVENT) {
             auto* pkt = (PacketKillEvent*)received.data.data();
 
             // A. T (UI)
             if (hudRef) {
-                hudRef->AddKillLog(pkt->killerID, pkt->victimID, pkt->killerTeam, pkt->victimTeam);
+                hudRef->AddKillLog(pkt->killerID, pkt->victimID, pkt->killerTeam, pkt->victimTeam, GetPlayerTurfPoints(pkt->killerID));
             }
 
             // B. ˬdڬOO`
@@ -554,9 +705,7 @@ private:
 
         int team = (pkt.color.x > 0.5f) ? 1 : 2;    // red=1, green=2
 
-        auto p = std::make_unique<Projectile>(velocity, pkt.color, team, pkt.scale, pkt.playerID);
-        p->transform->position = pkt.origin;
-        projectiles.push_back(std::move(p));
+        projectiles.Spawn(pkt.origin, velocity, pkt.color, team, pkt.scale, pkt.playerID);
     }
 
     // sΫإ߻ݪa
@@ -581,121 +730,163 @@ private:
     }
 
     // luzsj
+    // nBddIAAvBzFF誺lu swap and pop  ( i eiALӪ٨SBz)
     void UpdateProjectiles(float dt) {
-        for (auto it = projectiles.begin(); it != projectiles.end(); ) {
-            Projectile* p = it->get();
-            p->UpdatePhysics(dt);
-            bool hitSomething = false;
-
-            // ˬdI ( + AI + ݪa)
-            std::vector<Entity*> targets;
-            targets.push_back(localPlayer.get());
-            if (enemyAI) targets.push_back(enemyAI.get());
-            for (auto& pair : remotePlayers) targets.push_back(pair.second.get());
-
-            for (Entity* target : targets) {
-                if (!target) continue;
-                int targetTeam = target->teamID;
-                if (targetTeam == p->ownerTeam) continue;
-
-                if (CheckCollision(p, target)) {
-                    Health* hp = target->GetComponent<Health>();
-                    if (hp) {
-                        bool wasAlive = !hp->isDead;
-                        hp->TakeDamage(10.0f);
-                        // ĤHQ
-                        //  15 ɤlAt 8.0fAClu@
-                        particleSystem->Emit(p->transform->position, p->inkColor, 15, 8.0f);
-
-                        if (wasAlive && hp->isDead) {
-                            if (NetworkManager::Instance().IsServer()) {
-                                int victimID = -99;
-                                if (target == localPlayer.get()) victimID = NetworkManager::Instance().GetMyPlayerID();
-                                else if (target == enemyAI.get()) victimID = 100;
-                                else {
-                                    //  RemotePlayer ID
-                                    for (auto& rp : remotePlayers) {
-                                        if (rp.second.get() == target) {
-                                            victimID = rp.first;
-                                            break;
-                                        }
+        projectiles.Integrate(dt);
+
+        // Ҧluo@BLy@ᵹd AABB 
+        size_t count = projectiles.Size();
+        levelSweeps.resize(count);
+        floorHits.resize(count);
+        for (size_t k = 0; k < count; k++) {
+            floorHits[k] = projectiles.ResolveFloorHit(k);
+            levelSweeps[k] = { projectiles.GetPrevPosition(k), projectiles.GetPosition(k), projectiles.GetWidth(k) * 0.5f };
+        }
+        level->collision.SweepSpheres(levelSweeps, levelHits);
+
+        size_t i = 0;
+        while (i < projectiles.Size()) {
+            bool hitFloor = floorHits[i] != 0;
+            glm::vec3 pos = projectiles.GetPosition(i);
+            glm::vec3 inkColor = projectiles.color[i];
+            int ownerTeam = projectiles.team[i];
+            int ownerID = projectiles.owner[i];
+            float width = projectiles.GetWidth(i);
+            float radius = width * 0.5f;
+            glm::vec3 prev = projectiles.GetPrevPosition(i);
+
+            // o@BLuq (prev -> pos) I֡GH (n) 
+            // uduql̪HAAΥثemTPw (Q AI o@VwgǦ^I)
+            Entity* target = nullptr;
+            float hitT = 1.0f;
+            entityGrid.QueryCapsule(prev, pos, radius, hitCandidates);
+            for (Entity* e : hitCandidates) {
+                if (e->teamID == ownerTeam) continue;
+                float t;
+                if (CheckCollision(prev, pos, radius, e, t) && (!target || t < hitT)) {
+                    target = e;
+                    hitT = t;
+                }
+            }
+
+            const LevelBVH::Hit& levelHit = levelHits[i];
+            bool hitLevel = levelHit.box >= 0;
+
+            if (target && (!hitLevel || hitT <= levelHit.t)) {
+                glm::vec3 hitPos = prev + (pos - prev) * hitT;
+                Health* hp = target->GetComponent<Health>();
+                if (hp) {
+                    bool wasAlive = !hp->isDead;
+                    hp->TakeDamage(10.0f);
+                    // ĤHQ
+                    //  15 ɤlAt 8.0fAClu@
+                    particleSystem->Emit(hitPos, inkColor, 15, 8.0f);
+
+                    if (wasAlive && hp->isDead) {
+                        if (NetworkManager::Instance().IsServer()) {
+                            int victimID = -99;
+                            if (target == localPlayer.get()) victimID = NetworkManager::Instance().GetMyPlayerID();
+                            else if (target == enemyAI.get()) victimID = 100;
+                            else {
+                                //  RemotePlayer ID
+                                for (auto& rp : remotePlayers) {
+                                    if (rp.second.get() == target) {
+                                        victimID = rp.first;
+                                        break;
                                     }
                                 }
+                            }
 
-                                // sned kill packet
-                                PacketKillEvent pkt;
-                                pkt.header.type = PacketType::S2C_KILL_EVENT;
-                                pkt.killerID = p->ownerID;
-                                pkt.victimID = victimID;
-                                pkt.killerTeam = p->ownerTeam;
-                                pkt.victimTeam = hp->teamID;
+                            // sned kill packet
+                            PacketKillEvent pkt;
+                            pkt.header.type = PacketType::S2C_KILL_EVENT;
+                            pkt.killerID = ownerID;
+                            pkt.victimID = victimID;
+                            pkt.killerTeam = ownerTeam;
+                            pkt.victimTeam = hp->teamID;
 
-                                NetworkManager::Instance().Broadcast(&pkt, sizeof(pkt), true);
+                            NetworkManager::Instance().Broadcast(&pkt, sizeof(pkt), true);
 
-                                if (hudRef) hudRef->AddKillLog(p->ownerID, victimID, p->ownerTeam, hp->teamID);
-                            }
+                            if (hudRef) hudRef->AddKillLog(ownerID, victimID, ownerTeam, hp->teamID, GetPlayerTurfPoints(ownerID));
+                        }
 
-                            // A. pGOa
-                            if (target == localPlayer.get()) {
-                                localPlayer->Die();
-                                SpawnDeathSplat(localPlayer->transform->position, p->inkColor);
-                            }
-                            // B. pGO AI
-                            else if (target == enemyAI.get()) {
-                                SpawnDeathSplat(enemyAI->transform->position, p->inkColor);
-                                hp->Reset();
-                                enemyAI->transform->position = hp->spawnPoint;
-                            }
+                        // A. pGOa
+                        if (target == localPlayer.get()) {
+                            localPlayer->Die();
+                            SpawnDeathSplat(localPlayer->transform->position, inkColor, ownerTeam, ownerID);
+                        }
+                        // B. pGO AI
+                        else if (target == enemyAI.get()) {
+                            SpawnDeathSplat(enemyAI->transform->position, inkColor, ownerTeam, ownerID);
+                            hp->Reset();
+                            enemyAI->transform->position = hp->spawnPoint;
                         }
                     }
-                    if (localPlayer && p->ownerTeam == localPlayer->teamID) {
+                }
+                if (localPlayer && ownerTeam == localPlayer->teamID) {
 
-                        AudioManager::Instance().PlayOneShot("hit", 0.8f);
-                        if (hudRef) {
-                            hudRef->ShowHitMarker();
-                        }
+                    AudioManager::Instance().PlayOneShot("hit", 0.8f);
+                    if (hudRef) {
+                        hudRef->ShowHitMarker();
                     }
-                    hitSomething = true;
-                    break;
                 }
+                RemoveProjectile(i);
+                continue;
             }
 
-            if (hitSomething) {
-                it = projectiles.erase(it);
+            // BclI (o@VLyAaON)AbuI쪺m
+            // 줣 (~) @˷|UӡAuO
+            if (hitLevel) {
+                int face = level->GetHitFace(levelHit);
+                if (face >= 0) {
+                    glm::vec2 uv = level->surfaceAtlas.WorldToUV(face, levelHit.point);
+                    float rot = SplatStampLibrary::RotationFromPosition(uv);
+                    float paintSize = width * 0.7f;
+                    painter->Paint(splatMap.get(), uv, paintSize, inkColor, rot, ownerTeam, ownerID,
+                        level->surfaceAtlas.GetClipUV(face));
+                }
+                particleSystem->Emit(levelHit.point + levelHit.normal * 0.2f, inkColor, 10, 5.0f);
+                RemoveProjectile(i);
                 continue;
             }
 
             // aOIa
-            if (p->hasHitFloor) {
+            if (hitFloor) {
                 auto result = SplatPhysics::WorldToUV(
-                    p->hitPosition, level->floor->transform->position,
+                    pos, level->floor->transform->position,
                     level->floor->width, level->floor->depth
                 );
 
                 if (result.hit) {
-                    float rot = (float)(rand() % 360);
-                    float paintSize = p->transform->scale.x * 0.7f;
-                    painter->Paint(splatMap.get(), result.uv, paintSize, p->inkColor, rot, p->ownerTeam);
+                    float rot = SplatStampLibrary::RotationFromPosition(result.uv);
+                    float paintSize = width * 0.7f;
+                    painter->Paint(splatMap.get(), result.uv, paintSize, inkColor, rot, ownerTeam, ownerID);
                     // [sW] aOQ
                     //  10 ɤlAt 5.0f
-                    particleSystem->Emit(p->hitPosition + glm::vec3(0, 0.2f, 0), p->inkColor, 10, 5.0f);
+                    particleSystem->Emit(pos + glm::vec3(0, 0.2f, 0), inkColor, 10, 5.0f);
 
                     // charge ultimate
-                    if (localPlayer && p->ownerID == NetworkManager::Instance().GetMyPlayerID()) {
+                    if (localPlayer && ownerID == NetworkManager::Instance().GetMyPlayerID()) {
                         // localPlayer->AddSpecialCharge(0.5f);
                     }
                 }
-                it = projectiles.erase(it);
-            }
-            else if (p->isDead) {
-                it = projectiles.erase(it);
-            }
-            else {
-                ++it;
+                RemoveProjectile(i);
+                continue;
             }
+            i++;
         }
     }
 
+    //  ProjectileSystem::Remove @ swap and popAo@VdߵG]n۴
+    void RemoveProjectile(size_t i) {
+        size_t last = projectiles.Size() - 1;
+        levelHits[i] = levelHits[last];
+        floorHits[i] = floorHits[last];
+        levelHits.pop_back();
+        floorHits.pop_back();
+        projectiles.Remove(i);
+    }
+
     // BzƥGѧO -> oeʥ] -> sa UI
     void ProcessKillEvent(int killerID, Entity* victim, int killerTeam) {
         int victimID = -99;
@@ -736,64 +927,43 @@ private:
 
         // 4. s Server a (UI)
         if (hudRef) {
-            hudRef->AddKillLog(killerID, victimID, killerTeam, victim->teamID);
+            hudRef->AddKillLog(killerID, victimID, killerTeam, victim->teamID, GetPlayerTurfPoints(killerID));
         }
     }
 
     void TriggerLaserBeam(glm::vec3 start, glm::vec3 dir, int teamID, int attackerID) {
         float maxDist = 60.0f; // ̤jg{
-        float stepSize = 1.0f;
 
-        glm::vec3 currentPos = start;
         glm::vec3 endPos = start + (dir * maxDist);
 
-        // 1. M伲I (raycast)
-        for (float d = 0; d < maxDist; d += stepSize) {
-            currentPos += dir * stepSize;
-            float terrainH = level->GetHeightAt(currentPos.x, currentPos.z);
-
-            // pGaΰ > pgסANF
-            if (terrainH > currentPos.y) {
-                endPos = currentPos; // sII
-                break;
-            }
+        // 1. M伲I (u׳lA]||)
+        float hitT;
+        if (level->Raycast(start, endPos, hitT)) {
+            endPos = start + (endPos - start) * hitT; // sII
         }
 
         // 2. e
-        // q_IIACj@qZe@Ӿ
-        float dist = glm::distance(start, endPos);
-        float inkSpacing = 1.5f;
-        int paintSteps = (int)(dist / inkSpacing);
-
+        // _IIvaOA@ne
         // laser width
         float beamWidth = 4.0f;
         float uvSize = beamWidth / level->mapSize;
         glm::vec3 color = (teamID == 1) ? glm::vec3(1, 0, 0) : glm::vec3(0, 1, 0);
 
-        // uuøs
-        for (int i = 0; i <= paintSteps; i++) {
-            float t = (float)i / (float)paintSteps;
-            glm::vec3 paintPos = glm::mix(start, endPos, t);
-
-            auto result = SplatPhysics::WorldToUV(paintPos, glm::vec3(0), level->mapSize, level->mapSize);
-            if (result.hit) {
-                painter->Paint(splatMap.get(), result.uv, uvSize, color, 0, teamID);
-            }
-        }
+        glm::vec2 startUV = SplatPhysics::WorldToUVUnbounded(start, glm::vec3(0), level->mapSize, level->mapSize);
+        glm::vec2 endUV = SplatPhysics::WorldToUVUnbounded(endPos, glm::vec3(0), level->mapSize, level->mapSize);
+        // aO~ GPU (viewport) P CPU (SplatCoverage) |ۤv
+        painter->PaintStroke(splatMap.get(), startUV, endUV, uvSize, color, teamID, attackerID);
 
         AudioManager::Instance().PlayOneShot("laser_fire", 1.0f);
 
         if (!NetworkManager::Instance().IsServer()) return; // ˮ` Server Pw
 
-        std::vector<Entity*> targets;
-        if (localPlayer) targets.push_back(localPlayer.get());
-        if (enemyAI) targets.push_back(enemyAI.get());
-        for (auto& pair : remotePlayers) targets.push_back(pair.second.get());
-
         // pgPwe (񾥤eפp@IAnD)
         float hitWidth = 3.0f;
 
-        for (Entity* t : targets) {
+        // l̪]yt}AOOW@خɪmGd߽deAAΥثe}mTPw
+        entityGrid.QueryCapsule(start, endPos, hitWidth + ENTITY_GRID_SLACK, hitCandidates);
+        for (Entity* t : hitCandidates) {
             // p I(Enemy)  uq(Start-End) ̵uZ
             float d = PointToLineSegmentDistance(t->transform->position, start, endPos);
 
@@ -812,7 +982,7 @@ private:
                         if (t == localPlayer.get()) {
                             localPlayer->Die();
                         }
-                        SpawnDeathSplat(t->transform->position, color);
+                        SpawnDeathSplat(t->transform->position, color, teamID, attackerID);
                     }
                 }
             }
@@ -832,7 +1002,7 @@ private:
         return glm::distance(p, closest);
     }
 
-    void SpawnDeathSplat(glm::vec3 pos, glm::vec3 color) {
+    void SpawnDeathSplat(glm::vec3 pos, glm::vec3 color, int teamID, int ownerID) {
         // 1. ǳưѼ
         // ]aOߦb (0,0,0)ApGAaO첾AжJ level->floor->transform->position
         glm::vec3 floorPos = glm::vec3(0.0f, 0.0f, 0.0f);
@@ -845,17 +1015,30 @@ private:
 
         // 3. pGbd򤺡Ae
         if (result.hit) {
-            // H
-            float rot = (float)(rand() % 360);
+            // ਤץѦmMw (Cx\Xӳ@)
+            float rot = SplatStampLibrary::RotationFromPosition(result.uv);
             float uvSize = 4.0f / mapSize;
 
-            painter->Paint(splatMap.get(), result.uv, uvSize, color, rot, 0);
+            painter->Paint(splatMap.get(), result.uv, uvSize, color, rot, teamID, ownerID);
 
             // 񭵮
             AudioManager::Instance().PlayOneShot("splat_die", 0.5f);
         }
     }
 
+    // CӰϰ@ SAT d
+    void UpdateZoneScores() {
+        if (!level || !splatMap) return;
+
+        zoneScores.resize(level->zones.size());
+        for (size_t i = 0; i < level->zones.size(); i++) {
+            const Level::Zone& zone = level->zones[i];
+            glm::vec2 uvA = SplatPhysics::WorldToUVUnbounded(glm::vec3(zone.min.x, 0, zone.min.y), glm::vec3(0), level->mapSize, level->mapSize);
+            glm::vec2 uvB = SplatPhysics::WorldToUVUnbounded(glm::vec3(zone.max.x, 0, zone.max.y), glm::vec3(0), level->mapSize, level->mapSize);
+            zoneScores[i] = splatMap->GetZoneCoverage(uvA, uvB);
+        }
+    }
+
     void EndGame() {
         if (state == WorldState::FINISHED) return;
 
@@ -863,14 +1046,23 @@ private:
         finishTimer = 5.0f; // d 5 
         gameTimeRemaining = 0.0f;
 
-        // p̲פ
+        // p̲פ (٦bCe)
+        if (painter) painter->Flush();
         auto scores = splatMap->CalculatePercentages();
         finalScoreTeam1 = scores.first * 100;
         finalScoreTeam2 = scores.second * 100;
 
-        if (finalScoreTeam1 > finalScoreTeam2) winningTeam = 1;
-        else if (finalScoreTeam2 > finalScoreTeam1) winningTeam = 2;
-        else winningTeam = 0;
+        winningTeam = splatMap->GetWinningTeam();
+
+        // ӤHƪŪWqpƾAΦA@a
+        std::vector<std::pair<int, int64_t>> playerTexels;
+        splatMap->GetAllPlayerTexels(playerTexels);
+        finalPlayerTurf.clear();
+        for (const auto& entry : playerTexels) {
+            finalPlayerTurf.push_back({ entry.first, GetPlayerTeam(entry.first), GetPlayerTurfPoints(entry.first) });
+        }
+        std::sort(finalPlayerTurf.begin(), finalPlayerTurf.end(),
+            [](const PlayerTurf& a, const PlayerTurf& b) { return a.points > b.points; });
 
         std::cout << "GAME FINISHED! T1: " << finalScoreTeam1 << " T2: " << finalScoreTeam2 << std::endl;
         AudioManager::Instance().PlayOneShot("whistle", 1.0f);
@@ -1,6 +1,8 @@
 #pragma once
 #include <vector>
+#include <algorithm>
 #include <glm/glm.hpp>
+#include "../splat/SplatSurfaceAtlas.h"
 
 // Ic
 struct LevelVertex {
@@ -11,81 +13,87 @@ struct LevelVertex {
 
 class LevelGeometry {
 public:
-    // ͤ@Ӥ (aBclBq)
-    // x, y, z: ߦm
-    // size: jp (b|)
-    // mapSize: ӦaϪ`e (Ψӭp UVAo SplatMap ܭnI)
-    static void AddCube(std::vector<LevelVertex>& verts, float x, float y, float z, float size, float mapSize) {
-        // F²ơAo̥u "W (Top)"B""
-        // SplatMap DnOѤWUvAҥH UV p̭n
-
-        float s = size;
-
-        // wq 8 Ө
-        glm::vec3 p0(-s, -s, s); glm::vec3 p1(s, -s, s);
-        glm::vec3 p2(s, s, s); glm::vec3 p3(-s, s, s);
-        glm::vec3 p4(-s, -s, -s); glm::vec3 p5(s, -s, -s);
-        glm::vec3 p6(s, s, -s); glm::vec3 p7(-s, s, -s);
-
-        // 첾
-        glm::vec3 offset(x, y, z);
-        p0 += offset; p1 += offset; p2 += offset; p3 += offset;
-        p4 += offset; p5 += offset; p6 += offset; p7 += offset;
-
-        // U Lambda: ͭ
-        auto AddFace = [&](glm::vec3 a, glm::vec3 b, glm::vec3 c, glm::vec3 d, glm::vec3 n) {
-            // p UV (Planar Projection from Top)
-            // N XZ yЬMg 0~1
-            // ]aϤ߬O 0,0AdO -mapSize/2  mapSize/2
-            auto GetUV = [&](glm::vec3 p) {
-                return glm::vec2((p.x / mapSize) + 0.5f, (p.z / mapSize) + 0.5f);
-                };
-
-            verts.push_back({ a, n, GetUV(a) });
-            verts.push_back({ b, n, GetUV(b) });
-            verts.push_back({ c, n, GetUV(c) });
-            verts.push_back({ c, n, GetUV(c) });
-            verts.push_back({ d, n, GetUV(d) });
-            verts.push_back({ a, n, GetUV(a) });
-            };
-
-        // Top Face (̭nAΨӶa)
-        AddFace(p7, p6, p2, p3, glm::vec3(0, 1, 0));
-
-        // Side Faces ()
-        AddFace(p3, p2, p1, p0, glm::vec3(0, 0, 1)); // Front
-        AddFace(p2, p6, p5, p1, glm::vec3(1, 0, 0)); // Right
-        AddFace(p6, p7, p4, p5, glm::vec3(0, 0, -1)); // Back
-        AddFace(p7, p3, p0, p4, glm::vec3(-1, 0, 0)); // Left
+    // AddBox nͭǭ (ݤ쪺Φ atlas)
+    enum FaceMask {
+        FACE_TOP = 1,
+        FACE_FRONT = 2,  // +Z
+        FACE_BACK = 4,   // -Z
+        FACE_RIGHT = 8,  // +X
+        FACE_LEFT = 16,  // -X
+        FACE_ALL = 31    // KۦaOAû
+    };
+
+    // AddBox  faceIds ̧ǬO WB+ZB-ZB+XB-X
+    static constexpr int BOX_SIDES = 5;
+
+    // bku -> faceIds m ( = -1)
+    static int SideIndex(const glm::vec3& normal) {
+        if (normal.y > 0.5f) return 0;
+        if (normal.z > 0.5f) return 1;
+        if (normal.z < -0.5f) return 2;
+        if (normal.x > 0.5f) return 3;
+        if (normal.x < -0.5f) return 4;
+        return -1;
     }
 
-    // ͱשY (]OV_ ^)
-    static void AddRampNorth(std::vector<LevelVertex>& verts, float x, float y, float z, float size, float mapSize) {
-        float s = size;
-        glm::vec3 offset(x, y, z);
-
-        // שYu 6 I (ӷl)
-        // C (n)
-        glm::vec3 l1(-s, -s, s); glm::vec3 l2(s, -s, s);
-        //  (_)
-        glm::vec3 h1(-s, s, -s); glm::vec3 h2(s, s, -s);
-        // 
-        glm::vec3 b1(-s, -s, -s); glm::vec3 b2(s, -s, -s);
+    // @ӥiHxέGb atlas Wt@ϰAòͨӤT
+    // uv OaϪ uv (SplatSurfaceAtlas )AC@ubۤvϰ
+    static int AddFace(std::vector<LevelVertex>& verts, SplatSurfaceAtlas& atlas,
+        const glm::vec3& origin, const glm::vec3& axisU, const glm::vec3& axisV, const glm::vec2& size) {
+        int face = atlas.AddFace(origin, axisU, axisV, size);
+        if (face < 0) return -1;
+
+        const SplatSurfaceAtlas::Face& f = atlas.faces[face];
+        glm::vec3 a = origin;
+        glm::vec3 b = origin + f.axisU * size.x;
+        glm::vec3 c = b + f.axisV * size.y;
+        glm::vec3 d = origin + f.axisV * size.y;
+        glm::vec2 uvA = atlas.LocalToUV(face, glm::vec2(0.0f, 0.0f));
+        glm::vec2 uvB = atlas.LocalToUV(face, glm::vec2(size.x, 0.0f));
+        glm::vec2 uvC = atlas.LocalToUV(face, size);
+        glm::vec2 uvD = atlas.LocalToUV(face, glm::vec2(0.0f, size.y));
+
+        verts.push_back({ a, f.normal, uvA });
+        verts.push_back({ b, f.normal, uvB });
+        verts.push_back({ c, f.normal, uvC });
+        verts.push_back({ c, f.normal, uvC });
+        verts.push_back({ d, f.normal, uvD });
+        verts.push_back({ a, f.normal, uvA });
+        return face;
+    }
 
-        l1 += offset; l2 += offset; h1 += offset; h2 += offset; b1 += offset; b2 += offset;
+    // b (clBq)
+    // center: ߦmAhalfSize: Ubb|
+    // faceIds (iH)GC@b atlas s (BOX_SIDES ӡASͪ = -1)
+    static void AddBox(std::vector<LevelVertex>& verts, SplatSurfaceAtlas& atlas, const glm::vec3& center, const glm::vec3& halfSize, int faceMask = FACE_ALL,
+        int* faceIds = nullptr) {
+        glm::vec3 lo = center - halfSize;
+        glm::vec3 hi = center + halfSize;
+        glm::vec3 size = halfSize * 2.0f;
+
+        const glm::vec3 X(1, 0, 0), Y(0, 1, 0), Z(0, 0, 1);
+
+        // origin / axisU / axisV  cross(axisU, axisV) ¥~
+        int ids[BOX_SIDES] = { -1, -1, -1, -1, -1 };
+        if (faceMask & FACE_TOP)   ids[0] = AddFace(verts, atlas, glm::vec3(lo.x, hi.y, hi.z), X, -Z, glm::vec2(size.x, size.z));
+        if (faceMask & FACE_FRONT) ids[1] = AddFace(verts, atlas, glm::vec3(lo.x, lo.y, hi.z), X, Y, glm::vec2(size.x, size.y));
+        if (faceMask & FACE_BACK)  ids[2] = AddFace(verts, atlas, glm::vec3(hi.x, lo.y, lo.z), -X, Y, glm::vec2(size.x, size.y));
+        if (faceMask & FACE_RIGHT) ids[3] = AddFace(verts, atlas, glm::vec3(hi.x, lo.y, hi.z), -Z, Y, glm::vec2(size.z, size.y));
+        if (faceMask & FACE_LEFT)  ids[4] = AddFace(verts, atlas, glm::vec3(lo.x, lo.y, lo.z), Z, Y, glm::vec2(size.z, size.y));
+        if (faceIds) std::copy(ids, ids + BOX_SIDES, faceIds);
+    }
 
-        auto GetUV = [&](glm::vec3 p) { return glm::vec2((p.x / mapSize) + 0.5f, (p.z / mapSize) + 0.5f); };
+    // ͱשY (]OV_ ^AnCB_䰪)
+    static void AddRampNorth(std::vector<LevelVertex>& verts, SplatSurfaceAtlas& atlas, const glm::vec3& center, const glm::vec3& halfSize) {
+        glm::vec3 lo = center - halfSize;
+        glm::vec3 hi = center + halfSize;
 
-        // ׭ (Slope)
-        // kuݭnpG(0, 1, 1) normalize -> (0, 0.7, 0.7)
-        glm::vec3 n = glm::normalize(glm::vec3(0, 1, 1));
+        // ׭ (Slope)Gqn䪺_䪺
+        glm::vec3 up = glm::vec3(0.0f, hi.y - lo.y, lo.z - hi.z);
+        AddFace(verts, atlas, glm::vec3(lo.x, lo.y, hi.z), glm::vec3(1, 0, 0), up, glm::vec2(hi.x - lo.x, glm::length(up)));
 
-        verts.push_back({ l1, n, GetUV(l1) });
-        verts.push_back({ l2, n, GetUV(l2) });
-        verts.push_back({ h2, n, GetUV(h2) });
-        verts.push_back({ h2, n, GetUV(h2) });
-        verts.push_back({ h1, n, GetUV(h1) });
-        verts.push_back({ l1, n, GetUV(l1) });
+        // _䪺
+        AddFace(verts, atlas, glm::vec3(hi.x, lo.y, lo.z), glm::vec3(-1, 0, 0), glm::vec3(0, 1, 0), glm::vec2(hi.x - lo.x, hi.y - lo.y));
 
         //  (T)
         // ... (F²ơAȮɬٲAάO)
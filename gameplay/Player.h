@@ -11,6 +11,7 @@
 #include "BrushWeapon.h"
 #include "SlosherWeapon.h"
 #include "../splat/SplatMap.h"
+#include "../splat/SplatPhysics.h"
 
 enum class PlayerState {
     ALIVE,      // `C
@@ -59,6 +60,7 @@ public:
     float currentRegenDelay = 0.0f;  // pɾ
     float mapLimit = 39.5f;
     float floorSize = 80.0f;
+    float inkTolerance = 0.3f;       // PwbWeeZ ()
 
     Player(glm::vec3 startPos, int team, SplatMap* map, GameObject* cam, HUD* hud)
         : Entity("Player"), splatMapRef(map), cameraRef(cam), hudRef(hud)
@@ -89,6 +91,7 @@ public:
 
     // D޿s
     void UpdateLogic(float dt) {
+        glm::vec2 footUV;
         switch (state) {
         case PlayerState::ALIVE:
             HandleInput(dt);
@@ -98,12 +101,9 @@ public:
             }
 
             // Ҥ 
-            if (splatMapRef) {
-                float u = (transform->position.x / floorSize) + 0.5f;
-                float v = (transform->position.z / floorSize) + 0.5f;
-
+            if (splatMapRef && GetFootUV(footUV)) {
                 int enemyTeam = (teamID == 1) ? 2 : 1;
-                bool onEnemyInk = splatMapRef->IsColorInArea(u, v, enemyTeam, 1);
+                bool onEnemyInk = splatMapRef->IsInkWithin(footUV.x, footUV.y, enemyTeam, inkTolerance / floorSize);
 
                 auto healthComp = GetComponent<Health>();
                 if (healthComp) {
@@ -204,12 +204,20 @@ private:
         jumpStartPos = glm::vec3(0, 15.0f, 40.0f * zDir); // ŭI
         return jumpStartPos;
     }
+
+    // }U UV (M\ΦP@M SplatPhysics )A}aO^ false
+    bool GetFootUV(glm::vec2& uv) const {
+        SplatPhysics::HitResult hit = SplatPhysics::WorldToUV(transform->position, glm::vec3(0.0f), floorSize, floorSize);
+        uv = hit.uv;
+        return hit.hit;
+    }
+
     void UpdateDeadState(float dt) {
         respawnTimer -= dt;
 
         if (cameraRef) {
             cameraRef->transform->position = GetSpawnPosition();
-            cameraRef->transform->LookAt(glm::vec3(sin(glfwGetTime())*5.0f, 0, 0));
+            cameraRef->transform->LookAt(glm::vec3(sin(respawnTimer) * 5.0f, 0, 0)); // ɶAݯu
         }
 
         if (respawnTimer <= 0.0f) {
@@ -253,10 +261,9 @@ private:
         if (!cameraRef) return;
 
         bool onMyInk = false;
-        if (splatMapRef) {
-            float u = (transform->position.x + floorSize / 2.0f) / floorSize;
-            float v = 1.0f - ((transform->position.z + floorSize / 2.0f) / floorSize);
-            onMyInk = splatMapRef->IsColorInArea(u, v, teamID, 1);
+        glm::vec2 footUV;
+        if (splatMapRef && GetFootUV(footUV)) {
+            onMyInk = splatMapRef->IsInkWithin(footUV.x, footUV.y, teamID, inkTolerance / floorSize);
         }
 
         bool wantSwim = Input::GetKey(GLFW_KEY_LEFT_SHIFT);
@@ -0,0 +1,115 @@
+#pragma once
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include "ProjectileSystem.h"
+#include "../components/MeshRenderer.h"
+#include "../engine/rendering/Shader.h"
+
+// Ҧlu@ instanced draw e
+// CluuW m / | / t / CAutפVԦ (yжb + squash and stretch) b projectile.vert 
+// yۤvؤ@ ( MeshFactory::GetSphere })Ainstance ݩʱb VAO W
+class ProjectileRenderer {
+private:
+    Shader* shader;
+    std::shared_ptr<Mesh> sphere;
+    unsigned int instanceVBO;
+    size_t instanceCapacity = 0;
+
+    // ΨӶǵ GPU Ҹ
+    struct InstanceData {
+        glm::vec3 offset;
+        float scale;
+        glm::vec3 velocity;
+        glm::vec3 color;
+    };
+    std::vector<InstanceData> instanceData;
+
+public:
+    ProjectileRenderer() {
+        shader = new Shader("assets/shaders/projectile.vert", "assets/shaders/projectile.frag");
+        InitRenderData();
+    }
+
+    ~ProjectileRenderer() {
+        delete shader;
+        glDeleteBuffers(1, &instanceVBO);
+    }
+
+    // e current program O projectile shaderAIsݭnۤv Bind ^쥻 shader
+    // alphaGebW@ tick M̷s tick m (TwBe)
+    void Draw(const ProjectileSystem& projectiles, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& viewPos,
+        float alpha = 1.0f) {
+        size_t n = projectiles.Size();
+        if (n == 0) return;
+
+        // ǳƹҸ (SoA -> ƦC)
+        instanceData.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            InstanceData& d = instanceData[i];
+            d.offset = glm::mix(projectiles.GetPrevPosition(i), projectiles.GetPosition(i), alpha);
+            d.scale = ProjectileSystem::BASE_SIZE;
+            d.velocity = projectiles.GetVelocity(i);
+            d.color = projectiles.color[i];
+        }
+
+        // s Instance VBO (j~stm)
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        if (n > instanceCapacity) {
+            instanceCapacity = n * 2;
+            glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, n * sizeof(InstanceData), instanceData.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        shader->Bind();
+        shader->SetMat4("view", view);
+        shader->SetMat4("projection", projection);
+        shader->SetVec3("viewPos", viewPos);
+        shader->SetFloat("stretchPerSpeed", ProjectileSystem::STRETCH_PER_SPEED);
+
+        // øs
+        sphere->Bind();
+        glDrawElementsInstanced(GL_TRIANGLES, sphere->GetCount(), GL_UNSIGNED_INT, 0, (GLsizei)n);
+        sphere->Unbind();
+    }
+
+private:
+    void InitRenderData() {
+        //  MeshFactory::GetSphere @ (16 x 16)AeXӸ쥻@@eluۦP
+        sphere = MeshFactory::CreateSphere(16, 16);
+
+        glGenBuffers(1, &instanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        instanceCapacity = 256;
+        glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
+
+        // ]w Instance Attribute (m 3 ~ 6A0 ~ 2 O Mesh Iݩ)
+        sphere->Bind();
+
+        // Offset (Vec3)
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, offset)));
+        glVertexAttribDivisor(3, 1);
+
+        // Scale (Float)
+        glEnableVertexAttribArray(4);
+        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, scale)));
+        glVertexAttribDivisor(4, 1);
+
+        // Velocity (Vec3)
+        glEnableVertexAttribArray(5);
+        glVertexAttribPointer(5, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, velocity)));
+        glVertexAttribDivisor(5, 1);
+
+        // Color (Vec3)
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, color)));
+        glVertexAttribDivisor(6, 1);
+
+        sphere->Unbind();
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define PROJECTILE_SYSTEM_SSE2 1
+#endif
+
+// Ҧ椤luAC@}C (structure of arrays)
+// AO@@ EntityGS heap tmBSAɧ̫@hLӸɦ (swap and pop)AO(1)
+// n@Bz 4  (SSE2)ALx¶q
+//
+// eb ProjectileRenderer (@ instanced draw)Ao̥u
+//
+// `NGRemove |ܶǡAXɧRn GameWorld::UpdateProjectiles @ˡuRFNn i++v
+class ProjectileSystem {
+public:
+    static constexpr float GRAVITY = 30.0f;
+    static constexpr float STRETCH_PER_SPEED = 0.1f; // tרC 1 m/s Ԫ 10%
+    static constexpr float BASE_SIZE = 0.3f;         // SԦɪ| (ҦZ@)
+
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> prevX, prevY, prevZ;  // W@ Integrate em (Luq)
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> scale;                // Z]wjp (u۫ʥ]eA~ BASE_SIZE)
+    std::vector<int> team, owner;
+    std::vector<glm::vec3> color;
+
+    size_t Size() const { return posX.size(); }
+    bool Empty() const { return posX.empty(); }
+
+    void Reserve(size_t n) {
+        ForEachArray([n](auto& a) { a.reserve(n); });
+    }
+
+    void Clear() {
+        ForEachArray([](auto& a) { a.clear(); });
+    }
+
+    // ^Ƿslu index (U@ Remove e)
+    size_t Spawn(const glm::vec3& pos, const glm::vec3& vel, const glm::vec3& inkColor, int teamID, float diameter, int ownerID) {
+        posX.push_back(pos.x); posY.push_back(pos.y); posZ.push_back(pos.z);
+        prevX.push_back(pos.x); prevY.push_back(pos.y); prevZ.push_back(pos.z);
+        velX.push_back(vel.x); velY.push_back(vel.y); velZ.push_back(vel.z);
+        scale.push_back(diameter);
+        team.push_back(teamID);
+        owner.push_back(ownerID);
+        color.push_back(inkColor);
+        return posX.size() - 1;
+    }
+
+    // ̫@h iAA̫@殳
+    void Remove(size_t i) {
+        size_t last = posX.size() - 1;
+        if (i != last) {
+            ForEachArray([i, last](auto& a) { a[i] = a[last]; });
+        }
+        ForEachArray([](auto& a) { a.pop_back(); });
+    }
+
+    // O + b Euler (tצAηstײ)A쥻 Projectile::UpdatePhysics @
+    void Integrate(float dt) {
+        size_t n = Size();
+        size_t i = 0;
+#ifdef PROJECTILE_SYSTEM_SSE2
+        const __m128 vdt = _mm_set1_ps(dt);
+        const __m128 vg = _mm_set1_ps(GRAVITY * dt);
+        for (; i + 4 <= n; i += 4) {
+            __m128 px = _mm_loadu_ps(&posX[i]), py = _mm_loadu_ps(&posY[i]), pz = _mm_loadu_ps(&posZ[i]);
+            _mm_storeu_ps(&prevX[i], px);
+            _mm_storeu_ps(&prevY[i], py);
+            _mm_storeu_ps(&prevZ[i], pz);
+
+            __m128 vy = _mm_sub_ps(_mm_loadu_ps(&velY[i]), vg);
+            _mm_storeu_ps(&velY[i], vy);
+
+            _mm_storeu_ps(&posX[i], _mm_add_ps(px, _mm_mul_ps(_mm_loadu_ps(&velX[i]), vdt)));
+            _mm_storeu_ps(&posY[i], _mm_add_ps(py, _mm_mul_ps(vy, vdt)));
+            _mm_storeu_ps(&posZ[i], _mm_add_ps(pz, _mm_mul_ps(_mm_loadu_ps(&velZ[i]), vdt)));
+        }
+#endif
+        IntegrateScalar(i, n, dt);
+    }
+
+    // [begin, end) ¶q (SIMD ѤUڡBS SSE2 xBbenchmark Ӳ)
+    void IntegrateScalar(size_t begin, size_t end, float dt) {
+        for (size_t i = begin; i < end; i++) {
+            prevX[i] = posX[i]; prevY[i] = posY[i]; prevZ[i] = posZ[i];
+            velY[i] -= GRAVITY * dt;
+            posX[i] += velX[i] * dt;
+            posY[i] += velY[i] * dt;
+            posZ[i] += velZ[i] * dt;
+        }
+    }
+
+    glm::vec3 GetPosition(size_t i) const { return glm::vec3(posX[i], posY[i], posZ[i]); }
+    glm::vec3 GetPrevPosition(size_t i) const { return glm::vec3(prevX[i], prevY[i], prevZ[i]); }
+    glm::vec3 GetVelocity(size_t i) const { return glm::vec3(velX[i], velY[i], velZ[i]); }
+
+    void SetPosition(size_t i, const glm::vec3& p) {
+        posX[i] = p.x; posY[i] = p.y; posZ[i] = p.z;
+    }
+
+    // o@BLaO (y <= 0) ܡAh^ y = 0 @IA^ true
+    bool ResolveFloorHit(size_t i) {
+        if (posY[i] > 0.0f) return false;
+
+        float timeOvershoot = (std::abs(velY[i]) > 0.001f) ? posY[i] / velY[i] : 0.0f;
+        posX[i] -= velX[i] * timeOvershoot;
+        posZ[i] -= velZ[i] * timeOvershoot;
+        posY[i] = 0.0f;
+        return true;
+    }
+
+    // 椤ԦGt׶V֡AeiVVBIV (njP)
+    float GetStretch(size_t i) const {
+        float speed = std::sqrt(velX[i] * velX[i] + velY[i] * velY[i] + velZ[i] * velZ[i]);
+        return 1.0f + speed * STRETCH_PER_SPEED;
+    }
+
+    // Ԧ᪺I| (Ib|Bajpγo)
+    float GetWidth(size_t i) const {
+        return BASE_SIZE / std::sqrt(GetStretch(i));
+    }
+
+private:
+    template <typename F>
+    void ForEachArray(F f) {
+        f(posX); f(posY); f(posZ);
+        f(prevX); f(prevY); f(prevZ);
+        f(velX); f(velY); f(velZ);
+        f(scale); f(team); f(owner); f(color);
+    }
+};
\ No newline at end of file
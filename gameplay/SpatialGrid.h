@@ -0,0 +1,140 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+// RPwΪîl (XZ Aspatial hash)
+// C@V Clear -> Insert -> Build ؤ@A᪺lu / pg / dudۤvI쪺l
+//
+// CӪuiuߩҦb@vAd߮ɽdhXj maxRadius (̤jb|)AҥH|Ʀ^
+// ly hash  2  bucketABuild  counting sort Ʀn ( std::unordered_mapAؤtmO)
+// Pl hash P@ bucket ɡAΦsUӪlyФ}
+template <typename T>
+class SpatialGrid {
+public:
+    explicit SpatialGrid(float cellSize = 4.0f) : cellSize(cellSize), invCellSize(1.0f / cellSize) {}
+
+    void Clear() {
+        pending.clear();
+    }
+
+    // center / radiusG󪺥]y (d߮ɥγoyPw)
+    void Insert(const T& item, const glm::vec3& center, float radius) {
+        pending.push_back({ center, radius, Cell(center.x), Cell(center.z), 0u, item });
+    }
+
+    void Build() {
+        uint32_t buckets = 16;
+        while (buckets < pending.size() * 2) buckets *= 2;
+        bucketMask = buckets - 1;
+
+        bucketStart.assign(buckets + 1, 0u);
+        maxRadius = 0.0f;
+        for (Entry& e : pending) {
+            e.bucket = Hash(e.cellX, e.cellZ);
+            bucketStart[e.bucket + 1]++;
+            maxRadius = std::max(maxRadius, e.radius);
+        }
+        for (uint32_t b = 0; b < buckets; b++) bucketStart[b + 1] += bucketStart[b];
+
+        entries.resize(pending.size());
+        cursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+        for (const Entry& e : pending) entries[cursor[e.bucket]++] = e;
+    }
+
+    size_t Size() const { return entries.size(); }
+
+    // ]yy (center, radius) | (out |M)
+    void QuerySphere(const glm::vec3& center, float radius, std::vector<T>& out) const {
+        out.clear();
+        if (entries.empty()) return;
+
+        float ext = radius + maxRadius;
+        int x0 = Cell(center.x - ext), x1 = Cell(center.x + ext);
+        int z0 = Cell(center.z - ext), z1 = Cell(center.z + ext);
+        for (int cz = z0; cz <= z1; cz++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                VisitCell(cx, cz, [&](const Entry& e) {
+                    float r = radius + e.radius;
+                    glm::vec3 d = e.center - center;
+                    if (glm::dot(d, d) < r * r) out.push_back(e.item);
+                });
+            }
+        }
+    }
+
+    // ]yn (uq a-bAb| radius) |
+    // @C@CGuduq ([Wb|) bo@CڸgLXAתpg]|Ӥ
+    void QueryCapsule(const glm::vec3& a, const glm::vec3& b, float radius, std::vector<T>& out) const {
+        out.clear();
+        if (entries.empty()) return;
+
+        glm::vec3 ab = b - a;
+        float lengthSq = glm::dot(ab, ab);
+        float ext = radius + maxRadius;
+        int z0 = Cell(std::min(a.z, b.z) - ext), z1 = Cell(std::max(a.z, b.z) + ext);
+
+        for (int cz = z0; cz <= z1; cz++) {
+            // o@C (e ext) uqѼƽd [t0, t1]
+            float zLo = cz * cellSize - ext, zHi = (cz + 1) * cellSize + ext;
+            float t0 = 0.0f, t1 = 1.0f;
+            if (std::abs(ab.z) > 1e-6f) {
+                t0 = (zLo - a.z) / ab.z;
+                t1 = (zHi - a.z) / ab.z;
+                if (t0 > t1) std::swap(t0, t1);
+                t0 = std::max(t0, 0.0f);
+                t1 = std::min(t1, 1.0f);
+                if (t0 > t1) continue;
+            }
+            else if (a.z < zLo || a.z > zHi) {
+                continue;
+            }
+
+            float xa = a.x + ab.x * t0, xb = a.x + ab.x * t1;
+            int x0 = Cell(std::min(xa, xb) - ext), x1 = Cell(std::max(xa, xb) + ext);
+            for (int cx = x0; cx <= x1; cx++) {
+                VisitCell(cx, cz, [&](const Entry& e) {
+                    // Iuq̵uZ
+                    float t = (lengthSq > 0.0f) ? glm::clamp(glm::dot(e.center - a, ab) / lengthSq, 0.0f, 1.0f) : 0.0f;
+                    glm::vec3 d = e.center - (a + ab * t);
+                    float r = radius + e.radius;
+                    if (glm::dot(d, d) < r * r) out.push_back(e.item);
+                });
+            }
+        }
+    }
+
+private:
+    struct Entry {
+        glm::vec3 center;
+        float radius;
+        int cellX, cellZ;
+        uint32_t bucket;
+        T item;
+    };
+
+    float cellSize, invCellSize;
+    float maxRadius = 0.0f;
+    uint32_t bucketMask = 0;
+    std::vector<Entry> pending;           // Insert 
+    std::vector<Entry> entries;           //  bucket Ʀn
+    std::vector<uint32_t> bucketStart;    // bucket b b entries  [bucketStart[b], bucketStart[b + 1])
+    std::vector<uint32_t> cursor;         // Build 
+
+    int Cell(float v) const { return (int)std::floor(v * invCellSize); }
+
+    uint32_t Hash(int cx, int cz) const {
+        return ((uint32_t)cx * 73856093u ^ (uint32_t)cz * 19349663u) & bucketMask;
+    }
+
+    template <typename F>
+    void VisitCell(int cx, int cz, F f) const {
+        uint32_t b = Hash(cx, cz);
+        for (uint32_t i = bucketStart[b]; i < bucketStart[b + 1]; i++) {
+            const Entry& e = entries[i];
+            if (e.cellX == cx && e.cellZ == cz) f(e);
+        }
+    }
+};
\ No newline at end of file
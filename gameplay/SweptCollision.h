@@ -0,0 +1,72 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cmath>
+#include <algorithm>
+
+// sIGʤy (luo@Bq p0  p1) ｦn (H)
+// uݳ̫mܡA25 m/s lub 30 fps @B 0.8 mA|L 0.5 m 
+// yｦn = I (y) b|ۥ[nAҥHNOuqｦnDĤ@ӥI
+class SweptCollision {
+public:
+    // y (b| sphereRadius) u p0 -> p1 ʡAĤ@I콦n (b c0 -> c1Ab| capsuleRadius) m
+    // I^ trueAt = uqWm (0 ~ 1)F@}lN| t = 0
+    static bool SphereVsCapsule(const glm::vec3& p0, const glm::vec3& p1, float sphereRadius,
+                                const glm::vec3& c0, const glm::vec3& c1, float capsuleRadius, float& t) {
+        float r = sphereRadius + capsuleRadius;
+        if (PointSegmentDistanceSq(p0, c0, c1) <= r * r) {
+            t = 0.0f;
+            return true;
+        }
+
+        glm::vec3 d = p1 - p0;
+        float length = glm::length(d);
+        if (length < 1e-6f) return false;
+        glm::vec3 dir = d / length;
+
+        // n = W (uݤ) + ݪyA_Ib~AҥHT̳̦I
+        float best = length + 1.0f;
+
+        glm::vec3 axis = c1 - c0;
+        glm::vec3 oc = p0 - c0;
+        float axisSq = glm::dot(axis, axis);
+        float axisDir = glm::dot(axis, dir);
+        float axisOc = glm::dot(axis, oc);
+        float a = axisSq - axisDir * axisDir;
+        if (a > 1e-6f) {
+            float b = axisSq * glm::dot(dir, oc) - axisOc * axisDir;
+            float c = axisSq * glm::dot(oc, oc) - axisOc * axisOc - r * r * axisSq;
+            float h = b * b - a * c;
+            if (h >= 0.0f) {
+                float s = (-b - std::sqrt(h)) / a;
+                float y = axisOc + s * axisDir; // IbbWv (W axisSq)
+                if (s >= 0.0f && y > 0.0f && y < axisSq) best = s;
+            }
+        }
+        best = std::min(best, RaySphere(p0, dir, c0, r));
+        best = std::min(best, RaySphere(p0, dir, c1, r));
+
+        if (best > length) return false;
+        t = best / length;
+        return true;
+    }
+
+    static float PointSegmentDistanceSq(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b) {
+        glm::vec3 ab = b - a;
+        float lengthSq = glm::dot(ab, ab);
+        float s = (lengthSq > 0.0f) ? glm::clamp(glm::dot(p - a, ab) / lengthSq, 0.0f, 1.0f) : 0.0f;
+        glm::vec3 d = p - (a + ab * s);
+        return glm::dot(d, d);
+    }
+
+private:
+    // gu (dir OVq) Ĥ@iJyZASI^ǫܤj
+    static float RaySphere(const glm::vec3& origin, const glm::vec3& dir, const glm::vec3& center, float radius) {
+        glm::vec3 oc = origin - center;
+        float b = glm::dot(oc, dir);
+        float c = glm::dot(oc, oc) - radius * radius;
+        float h = b * b - c;
+        if (h < 0.0f) return 1e30f;
+        float s = -b - std::sqrt(h);
+        return (s >= 0.0f) ? s : 1e30f;
+    }
+};
\ No newline at end of file
@@ -1,7 +1,7 @@
 #pragma once
 #include <vector>
 #include <glm/glm.hpp>
-#include <GLFW/glfw3.h>
+#include <algorithm>
 #include <cstdlib> // rand
 
 struct SpawnInfo {
@@ -20,7 +20,7 @@ public:
 
     float fireRate;
     float inkCost;
-    float lastFireTime = 0.0f;
+    float cooldown = 0.0f; // U@o٭nh[ (ɶAݯu)
 
     std::vector<SpawnInfo> pendingSpawns;
 
@@ -30,15 +30,16 @@ public:
 
     virtual ~Weapon() {}
 
+    // CӼ tick Is@FɨC fireRate  (ɶ) og@
     virtual bool Trigger(float dt, glm::vec3 nozzlePos, glm::vec3 aimDir, bool isFiring) {
-        if (isFiring) {
-            float currentTime = (float)glfwGetTime();
-            if (currentTime - lastFireTime > fireRate) {
-                FireLogic(nozzlePos, aimDir);
-                lastFireTime = currentTime;
-                return true;
-            }
+        cooldown -= dt;
+        if (isFiring && cooldown <= 1e-4f) {
+            FireLogic(nozzlePos, aimDir);
+            // lƯdۡAgt~| tick ׼vT
+            cooldown = std::max(cooldown, -dt) + fireRate;
+            return true;
         }
+        cooldown = std::max(cooldown, 0.0f);
         return false;
     }
 
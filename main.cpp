@@ -3,9 +3,11 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <cstdlib>
 
 #include "engine/core/Window.h"
 #include "engine/core/Timer.h"
+#include "engine/core/FixedTimestep.h"
 #include "engine/core/Input.h"
 #include "engine/core/Logger.h"
 #include "engine/rendering/Shader.h"
@@ -31,6 +33,10 @@ enum class GameState {
 const unsigned int SCR_WIDTH = 1280;
 const unsigned int SCR_HEIGHT = 720;
 
+// ΩTw tick ]AesvLFeb tick 
+const float SIM_TICK = 1.0f / 60.0f;
+const int MAX_CATCH_UP_TICKS = 5;
+
 Camera* mainCamera = nullptr;
 
 void mouse_callback(GLFWwindow* window, double xpos, double ypos) {
@@ -39,16 +45,26 @@ void mouse_callback(GLFWwindow* window, double xpos, double ypos) {
     }
 }
 
-int main() {
+int main(int argc, char** argv) {
+    // --headless []GܵAu AI @ACPU ]hִN]h
+    bool headless = false;
+    double headlessSeconds = 180.0;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--headless") {
+            headless = true;
+            if (i + 1 < argc) headlessSeconds = std::atof(argv[++i]);
+        }
+    }
+
     // Network, Window, GUI Init
     NetworkManager::Instance().Initialize();
-    Window window(SCR_WIDTH, SCR_HEIGHT, "Tiny Splatoon");
+    Window window(SCR_WIDTH, SCR_HEIGHT, "Tiny Splatoon", !headless);
     glfwSetCursorPosCallback(window.GetNativeWindow(), mouse_callback);
     GUIManager gui(window.GetNativeWindow());
 
     glEnable(GL_DEPTH_TEST);
-    SceneManager::Instance().SwitchTo(std::make_unique<LoginScene>(&gui));
     Timer timer;
+    FixedTimestep sim(SIM_TICK, MAX_CATCH_UP_TICKS);
     AudioManager::Instance().Initialize();
     AudioManager::Instance().LoadSound("shoot", "assets/shoot.mp3");
     AudioManager::Instance().LoadSound("hit", "assets/hit.wav");
@@ -58,10 +74,14 @@ int main() {
     AudioManager::Instance().LoadSound("whistle", "assets/whistle.wav");
     AudioManager::Instance().LoadSound("swim", "assets/swim.mp3");
 
+    // GameScene @iN| BGMAҥHnĪlƧ~إ߳
+    if (headless) SceneManager::Instance().SwitchTo(std::make_unique<GameScene>());
+    else SceneManager::Instance().SwitchTo(std::make_unique<LoginScene>(&gui));
+
     // Game Loop
+    double wallStart = glfwGetTime();
     while (!window.ShouldClose()) {
         timer.Tick();
-        float dt = timer.GetDeltaTime();
 
         if (Input::GetKey(GLFW_KEY_ESCAPE)) break;
 
@@ -69,8 +89,21 @@ int main() {
         while (NetworkManager::Instance().HasPackets()) {
             SceneManager::Instance().HandlePacket(NetworkManager::Instance().PopPacket());
         }
-        SceneManager::Instance().Update(dt);
-        SceneManager::Instance().Render();
+
+        // headlessGݮAC]@ tickAҥH|uɶ
+        float frameTime = headless ? sim.GetStep() : timer.GetDeltaTime();
+        int ticks = sim.Advance(frameTime);
+        for (int i = 0; i < ticks; i++) {
+            SceneManager::Instance().Update(sim.GetStep());
+        }
+
+        if (headless) {
+            if (sim.GetSimTime() >= headlessSeconds) break;
+            window.PollEvents();
+            continue;
+        }
+
+        SceneManager::Instance().Render(sim.GetAlpha());
         gui.BeginFrame();
         SceneManager::Instance().DrawUI();
         gui.Render();
@@ -78,5 +111,10 @@ int main() {
         window.SwapBuffers();
         window.PollEvents();
     }
+
+    double wallSeconds = glfwGetTime() - wallStart;
+    std::cout << "[Sim] " << sim.GetTickCount() << " ticks, " << sim.GetSimTime() << " s simulated in " << wallSeconds
+        << " s (" << (wallSeconds > 0.0 ? sim.GetSimTime() / wallSeconds : 0.0) << "x real time), "
+        << sim.GetDroppedTicks() << " ticks dropped" << std::endl;
     return 0;
 }
\ No newline at end of file
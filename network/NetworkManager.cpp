@@ -108,10 +108,12 @@ void NetworkManager::Update() {
     }
 
     for (auto conn : connectionsToCheck) {
-        ISteamNetworkingMessage* pIncomingMsg = nullptr;
-        int numMsgs = m_pInterface->ReceiveMessagesOnConnection(conn, &pIncomingMsg, 1);
+        // @̦h 32 h (aϦPB|senXӫʥ])
+        ISteamNetworkingMessage* pIncomingMsgs[32];
+        int numMsgs = m_pInterface->ReceiveMessagesOnConnection(conn, pIncomingMsgs, 32);
 
-        if (numMsgs > 0) {
+        for (int i = 0; i < numMsgs; i++) {
+            ISteamNetworkingMessage* pIncomingMsg = pIncomingMsgs[i];
             // BzohT
             if (pIncomingMsg->GetSize() >= sizeof(PacketHeader)) {
                 ReceivedPacket pkt;
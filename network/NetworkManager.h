@@ -7,6 +7,7 @@
 #include <queue>
 #include <string>
 #include <map>
+#include <algorithm>
 #include "NetworkProtocol.h"
 
 struct ReceivedPacket {
@@ -53,6 +54,10 @@ public:
     bool IsServer() const { return m_IsServer; }
     bool IsConnected() const { return m_IsConnected; }
     int GetMyPlayerID() const { return m_MyID; }
+    // ServerGosu٦bb (_u OnConnectionStatusChangedHelper |⥦)
+    bool HasClient(HSteamNetConnection conn) const {
+        return std::find(m_ClientConnections.begin(), m_ClientConnections.end(), conn) != m_ClientConnections.end();
+    }
     void SetMyPlayerID(int id) { m_MyID = id; }
     int GetMyTeamID() const { return m_MyTeamID; }
     void SetMyTeamID(int team) { m_MyTeamID = team; }
@@ -22,12 +22,15 @@ enum class PacketType : uint8_t {
     S2C_SHOOT_EVENT,     // Server -> Client: YH}jF (jaͦlu)
     C2S_THROW_BOMB,      // Client -> Server: ڥᬵuF
     S2C_SPAWN_BOMB,      // Server -> All: HᬵuFAЦbA̪@ɥͦ
-    S2C_SPLAT_UPDATE,    // Server -> Client: aOożF (jae)
+    S2C_SPLAT_UPDATE,    // Server -> Client: YL tile (~[J / wե)
     S2C_LOBBY_UPDATE,    // Server -> Client: sjU 8 ӮlA
     S2C_GAME_START,      // Server -> Client: C}lI
     S2C_KILL_EVENT,      // q
     C2S_SPECIAL_ATTACK,  // Client -> Server: ڭn}j
-    S2C_SPECIAL_ATTACK   // Server -> Clients: H}j
+    S2C_SPECIAL_ATTACK,  // Server -> Clients: H}j
+    C2S_SPLAT_SYNC_REQUEST, // Client -> Server: аeiaϵ
+    S2C_SPLAT_HASH,      // Server -> Client: a hash (ˬdPB)
+    C2S_SPLAT_TILE_REQUEST // Client -> Server: o tile A@ˡAЭe
 };
 
 // Ҧʥ]@qY
@@ -104,13 +107,44 @@ struct PacketShoot {
     glm::vec3 color;
 };
 
-// 5. aPB (̺²)
+// 5. aPB (ܪʥ])
+// ᭱ tileCount  [SplatTileHeader + byteCount bytes Y]
 struct PacketSplatUpdate {
     PacketHeader header;
-    float u;
-    float v;
-    float radius;
-    int teamID;
+    uint32_t mapVersion;    // Server  SplatMap  version
+    uint16_t tileCount;
+};
+
+// tile Y覡
+enum class SplatTileEncoding : uint8_t {
+    RLE        = 0,  // C byte @q: (team << 6) | ( - 1)A̪ 64
+    BIT_PLANES = 1   //  1 byte аO planeAC plane 128 bytes (1 bit / texel)
+};
+
+struct SplatTileHeader {
+    uint16_t tileIndex;
+    SplatTileEncoding encoding;
+    uint16_t byteCount;
+};
+
+// ~[JɦV Server nia
+struct PacketSplatSyncRequest {
+    PacketHeader header;
+    int playerID;
+};
+
+// a hash (ܪʥ])A᭱ tileCount  uint16_t (C tile hash C 16 bits)
+struct PacketSplatHash {
+    PacketHeader header;
+    uint32_t mapHash;
+    uint16_t tileCount;
+};
+
+// eШD (ܪʥ])A᭱ tileCount  uint16_t tile index
+struct PacketSplatTileRequest {
+    PacketHeader header;
+    int playerID;
+    uint16_t tileCount;
 };
 
 struct PacketSpecialLaser {
@@ -0,0 +1,448 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include "NetworkManager.h"
+#include "NetworkProtocol.h"
+#include "../splat/SplatMap.h"
+#include "../engine/core/Logger.h"
+
+// aϦPB
+// ServerGH tile vª SplatCoverage YeC Client
+//   - ~[JGClient e C2S_SPLAT_SYNC_REQUESTAServer aϲMŤL tile eX
+//   - wեGCj@qɶ version ܪ tile Ae@
+//   - PBGCWvs map hash + C tile  hashAClient un^@˪ tile
+// ClientGMaA@˪ tile ~мg CPU ƨäWǶK
+class SplatReplicator {
+public:
+    static const int TILE_TEXELS = SplatCoverage::TILE_SIZE * SplatCoverage::TILE_SIZE;
+    static const int PLANE_BYTES = TILE_TEXELS / 8;
+    static const int MAX_TILE_BYTES = 1 + PLANE_BYTES * 2;
+
+    float sendInterval = 0.1f;        // h[e@
+    float deltaInterval = 1.0f;       // h[@ܰʪ tile
+    int maxBytesPerSecond = 64 * 1024; // C Client WeW
+    int maxPacketBytes = 4096;
+    float hashInterval = 3.0f;        // h[s@ hash
+
+    struct ClientStats {
+        uint64_t bytesSent = 0;
+        uint64_t tilesSent = 0;
+        float bytesPerSecond = 0.0f;  // ̪@Ӳέp϶
+        uint64_t tilesRequested = 0;  // Client ^ hash PӭnDe tile 
+    };
+
+    // Client ݪPBέp
+    struct DesyncMetrics {
+        uint64_t hashChecks = 0;      // X hash
+        uint64_t mapMismatches = 0;   // 䤤 map hash P
+        uint64_t tilesSuspected = 0;  // 榸 hash P tile (iuOʥ]٦bW)
+        uint64_t tilesRequested = 0;  // s⦸PATwPBӭnDe tile
+    };
+
+    explicit SplatReplicator(SplatMap* map) : map(map) {}
+
+    // --- Server ---
+
+    void OnSyncRequest(HSteamNetConnection conn) {
+        ClientState& client = clients[conn];
+        // Client aϬOŪGqW@MŤ}l (ueL tileAMŮɼаO tile e)
+        client.sentVersion = map->GetClearVersion();
+        client.pendingTiles.clear();
+        client.deltaTimer = deltaInterval;
+        Logger::Log("SplatSync: full map requested by connection " + std::to_string(conn));
+    }
+
+    // wg_usuAe (_uu|b NetworkManager ̳BzAǫCee@U)
+    void RemoveDisconnectedClients() {
+        for (auto it = clients.begin(); it != clients.end();) {
+            if (NetworkManager::Instance().HasClient(it->first)) ++it;
+            else {
+                Logger::Log("SplatSync: connection " + std::to_string(it->first) + " closed, dropping its sync state");
+                it = clients.erase(it);
+            }
+        }
+    }
+
+    // Client ^ hash P tileAƶio Client ݰeM
+    void OnTileRequest(HSteamNetConnection conn, const std::vector<uint8_t>& data) {
+        auto it = clients.find(conn);
+        if (it == clients.end() || data.size() < sizeof(PacketSplatTileRequest)) return;
+
+        PacketSplatTileRequest header;
+        memcpy(&header, data.data(), sizeof(header));
+        if (data.size() < sizeof(header) + header.tileCount * sizeof(uint16_t)) return;
+
+        ClientState& client = it->second;
+        for (int i = 0; i < header.tileCount; i++) {
+            uint16_t tile;
+            memcpy(&tile, data.data() + sizeof(header) + i * sizeof(uint16_t), sizeof(tile));
+            if (tile < map->coverage.GetTileCount()) client.pendingTiles.push_back(tile);
+        }
+        client.stats.tilesRequested += header.tileCount;
+    }
+
+    void UpdateServer(float dt) {
+        sendTimer += dt;
+        statsTimer += dt;
+        hashTimer += dt;
+
+        RemoveDisconnectedClients();
+
+        if (hashTimer >= hashInterval) {
+            BroadcastHashes();
+            hashTimer = 0.0f;
+        }
+
+        if (sendTimer >= sendInterval) {
+            for (auto& pair : clients) {
+                ClientState& client = pair.second;
+                client.deltaTimer += sendTimer;
+
+                // W@eF~sܰ
+                if (client.pendingTiles.empty() && client.deltaTimer >= deltaInterval) {
+                    map->GetTilesChangedSince(client.sentVersion, client.pendingTiles);
+                    client.sentVersion = map->GetVersion();
+                    client.nextPending = 0;
+                    client.deltaTimer = 0.0f;
+                }
+
+                SendPending(pair.first, client, (int)(maxBytesPerSecond * sendTimer));
+            }
+            sendTimer = 0.0f;
+        }
+
+        // C 10 L@U Client We
+        if (statsTimer >= 10.0f) {
+            for (auto& pair : clients) {
+                ClientStats& stats = pair.second.stats;
+                stats.bytesPerSecond = pair.second.bytesWindow / statsTimer;
+                pair.second.bytesWindow = 0;
+                Logger::Log("SplatSync: connection " + std::to_string(pair.first) + " " +
+                    std::to_string((int)(stats.bytesPerSecond / 1024.0f * 10.0f) / 10.0f) + " KB/s, total " +
+                    std::to_string(stats.bytesSent / 1024) + " KB, " + std::to_string(stats.tilesSent) + " tiles, " +
+                    std::to_string(stats.tilesRequested) + " re-requested");
+            }
+            statsTimer = 0.0f;
+        }
+    }
+
+    const ClientStats* GetClientStats(HSteamNetConnection conn) const {
+        auto it = clients.find(conn);
+        return (it != clients.end()) ? &it->second.stats : nullptr;
+    }
+
+    // --- Client ---
+
+    void RequestFullSync() {
+        PacketSplatSyncRequest pkt;
+        pkt.header.type = PacketType::C2S_SPLAT_SYNC_REQUEST;
+        pkt.playerID = NetworkManager::Instance().GetMyPlayerID();
+        NetworkManager::Instance().SendToServer(&pkt, sizeof(pkt), true);
+    }
+
+    void ApplyPacket(const std::vector<uint8_t>& data) {
+        if (data.size() < sizeof(PacketSplatUpdate)) return;
+        receivedBytes += data.size();
+
+        PacketSplatUpdate header;
+        memcpy(&header, data.data(), sizeof(header));
+
+        size_t offset = sizeof(PacketSplatUpdate);
+        uint64_t rows[SplatCoverage::TILE_SIZE];
+        bool batchStarted = false;
+
+        for (int i = 0; i < header.tileCount; i++) {
+            if (offset + sizeof(SplatTileHeader) > data.size()) break;
+            SplatTileHeader tile;
+            memcpy(&tile, data.data() + offset, sizeof(tile));
+            offset += sizeof(tile);
+            if (offset + tile.byteCount > data.size()) break;
+
+            const uint8_t* payload = data.data() + offset;
+            offset += tile.byteCount;
+
+            if (tile.tileIndex >= map->coverage.GetTileCount()) continue;
+            if (!DecodeTile(tile.encoding, payload, tile.byteCount, rows)) continue;
+
+            if (!batchStarted) {
+                map->BeginPaintBatch();
+                batchStarted = true;
+            }
+
+            bool changed = false;
+            for (int r = 0; r < SplatCoverage::TILE_SIZE; r++) {
+                changed |= map->coverage.SetTileRow(tile.tileIndex, r, rows[r]);
+            }
+            if (changed) {
+                map->UploadTileFromCPU(tile.tileIndex);
+                correctedTiles++;
+            }
+        }
+    }
+
+    //  Server  hashAs⦸P tile ~nDe
+    // (ut@q`O誺٦bWAU@N|@P)
+    void ApplyHashPacket(const std::vector<uint8_t>& data) {
+        if (data.size() < sizeof(PacketSplatHash)) return;
+        receivedBytes += data.size();
+
+        PacketSplatHash header;
+        memcpy(&header, data.data(), sizeof(header));
+        if (header.tileCount != map->coverage.GetTileCount()) return;
+        if (data.size() < sizeof(header) + header.tileCount * sizeof(uint16_t)) return;
+
+        metrics.hashChecks++;
+        if (header.mapHash == map->coverage.GetMapHash()) {
+            suspectTiles.clear();
+            return;
+        }
+        metrics.mapMismatches++;
+
+        std::vector<int> mismatched;
+        std::vector<uint16_t> confirmed;
+        for (int i = 0; i < header.tileCount; i++) {
+            uint16_t serverHash;
+            memcpy(&serverHash, data.data() + sizeof(header) + i * sizeof(uint16_t), sizeof(serverHash));
+            if (serverHash == (uint16_t)map->coverage.GetTileHash(i)) continue;
+
+            mismatched.push_back(i);
+            if (std::binary_search(suspectTiles.begin(), suspectTiles.end(), i)) {
+                confirmed.push_back((uint16_t)i);
+            }
+        }
+        metrics.tilesSuspected += mismatched.size();
+        suspectTiles.swap(mismatched);
+
+        if (confirmed.empty()) return;
+        metrics.tilesRequested += confirmed.size();
+        Logger::Warn("SplatSync: " + std::to_string(confirmed.size()) + " tiles out of sync, re-requesting");
+
+        PacketSplatTileRequest request;
+        request.header.type = PacketType::C2S_SPLAT_TILE_REQUEST;
+        request.playerID = NetworkManager::Instance().GetMyPlayerID();
+        request.tileCount = (uint16_t)confirmed.size();
+
+        packetBuffer.resize(sizeof(request) + confirmed.size() * sizeof(uint16_t));
+        memcpy(packetBuffer.data(), &request, sizeof(request));
+        memcpy(packetBuffer.data() + sizeof(request), confirmed.data(), confirmed.size() * sizeof(uint16_t));
+        NetworkManager::Instance().SendToServer(packetBuffer.data(), packetBuffer.size(), true);
+
+        // wgnDeFAU@s[
+        suspectTiles.clear();
+    }
+
+    const DesyncMetrics& GetDesyncMetrics() const { return metrics; }
+
+    uint64_t GetReceivedBytes() const { return receivedBytes; }
+    uint64_t GetCorrectedTiles() const { return correctedTiles; }
+
+    // --- Y ---
+
+    // سAp
+    static int EncodeTile(const SplatCoverage& coverage, int tileIndex, uint8_t* out, SplatTileEncoding& encoding) {
+        uint64_t rows[SplatCoverage::TILE_SIZE];
+        for (int r = 0; r < SplatCoverage::TILE_SIZE; r++) rows[r] = coverage.GetTileRow(tileIndex, r);
+
+        int planeBytes = EncodeBitPlanes(rows, out);
+        encoding = SplatTileEncoding::BIT_PLANES;
+
+        uint8_t rle[MAX_TILE_BYTES];
+        int rleBytes = EncodeRLE(rows, rle, planeBytes);
+        if (rleBytes > 0) {
+            memcpy(out, rle, rleBytes);
+            encoding = SplatTileEncoding::RLE;
+            return rleBytes;
+        }
+        return planeBytes;
+    }
+
+    // RLE S maxBytes pN (^ 0)
+    static int EncodeRLE(const uint64_t rows[], uint8_t* out, int maxBytes) {
+        int count = 0;
+        int runTeam = -1;
+        int runLength = 0;
+
+        for (int r = 0; r < SplatCoverage::TILE_SIZE; r++) {
+            uint64_t w = rows[r];
+            for (int x = 0; x < SplatCoverage::TEXELS_PER_WORD; x++) {
+                int team = (int)((w >> (x * 2)) & 3);
+                if (team == runTeam && runLength < 64) {
+                    runLength++;
+                    continue;
+                }
+                if (runLength > 0) {
+                    if (count >= maxBytes) return 0;
+                    out[count++] = (uint8_t)((runTeam << 6) | (runLength - 1));
+                }
+                runTeam = team;
+                runLength = 1;
+            }
+        }
+        if (count >= maxBytes) return 0;
+        out[count++] = (uint8_t)((runTeam << 6) | (runLength - 1));
+        return count;
+    }
+
+    // C줸 plane / 줸 plane U 1 bit per texelA 0  plane e
+    static int EncodeBitPlanes(const uint64_t rows[], uint8_t* out) {
+        uint8_t planes[2][PLANE_BYTES];
+        memset(planes, 0, sizeof(planes));
+        uint8_t planeMask = 0;
+
+        for (int r = 0; r < SplatCoverage::TILE_SIZE; r++) {
+            uint64_t w = rows[r];
+            for (int x = 0; x < SplatCoverage::TEXELS_PER_WORD; x++) {
+                int team = (int)((w >> (x * 2)) & 3);
+                int bit = r * SplatCoverage::TEXELS_PER_WORD + x;
+                if (team & 1) { planes[0][bit / 8] |= 1 << (bit % 8); planeMask |= 1; }
+                if (team & 2) { planes[1][bit / 8] |= 1 << (bit % 8); planeMask |= 2; }
+            }
+        }
+
+        int count = 0;
+        out[count++] = planeMask;
+        for (int p = 0; p < 2; p++) {
+            if (planeMask & (1 << p)) {
+                memcpy(out + count, planes[p], PLANE_BYTES);
+                count += PLANE_BYTES;
+            }
+        }
+        return count;
+    }
+
+    static bool DecodeTile(SplatTileEncoding encoding, const uint8_t* data, int size, uint64_t rows[]) {
+        for (int r = 0; r < SplatCoverage::TILE_SIZE; r++) rows[r] = 0;
+
+        if (encoding == SplatTileEncoding::RLE) {
+            int texel = 0;
+            for (int i = 0; i < size; i++) {
+                uint64_t team = data[i] >> 6;
+                int length = (data[i] & 63) + 1;
+                if (texel + length > TILE_TEXELS) return false;
+                for (int k = 0; k < length; k++, texel++) {
+                    rows[texel / 32] |= team << ((texel % 32) * 2);
+                }
+            }
+            return texel == TILE_TEXELS;
+        }
+
+        if (encoding == SplatTileEncoding::BIT_PLANES) {
+            if (size < 1) return false;
+            uint8_t planeMask = data[0];
+            int offset = 1;
+            for (int p = 0; p < 2; p++) {
+                if (!(planeMask & (1 << p))) continue;
+                if (offset + PLANE_BYTES > size) return false;
+                for (int bit = 0; bit < TILE_TEXELS; bit++) {
+                    if (data[offset + bit / 8] & (1 << (bit % 8))) {
+                        rows[bit / 32] |= (uint64_t)(1 << p) << ((bit % 32) * 2);
+                    }
+                }
+                offset += PLANE_BYTES;
+            }
+            return true;
+        }
+        return false;
+    }
+
+private:
+    struct ClientState {
+        uint32_t sentVersion = 0;
+        std::vector<int> pendingTiles;
+        size_t nextPending = 0;
+        float deltaTimer = 0.0f;
+        uint64_t bytesWindow = 0;
+        ClientStats stats;
+    };
+
+    SplatMap* map;
+    std::map<HSteamNetConnection, ClientState> clients;
+    float sendTimer = 0.0f;
+    float statsTimer = 0.0f;
+    float hashTimer = 0.0f;
+
+    std::vector<int> suspectTiles;   // W@ hash P tile (wƧ)
+    DesyncMetrics metrics;
+
+    std::vector<uint8_t> packetBuffer;
+    uint64_t receivedBytes = 0;
+    uint64_t correctedTiles = 0;
+
+    void BroadcastHashes() {
+        if (clients.empty()) return;
+
+        int tileCount = map->coverage.GetTileCount();
+        PacketSplatHash header;
+        header.header.type = PacketType::S2C_SPLAT_HASH;
+        header.mapHash = map->coverage.GetMapHash();
+        header.tileCount = (uint16_t)tileCount;
+
+        packetBuffer.resize(sizeof(header) + tileCount * sizeof(uint16_t));
+        memcpy(packetBuffer.data(), &header, sizeof(header));
+        for (int i = 0; i < tileCount; i++) {
+            uint16_t h = (uint16_t)map->coverage.GetTileHash(i);
+            memcpy(packetBuffer.data() + sizeof(header) + i * sizeof(uint16_t), &h, sizeof(h));
+        }
+
+        for (auto& pair : clients) {
+            NetworkManager::Instance().Send(pair.first, packetBuffer.data(), packetBuffer.size(), true);
+            pair.second.bytesWindow += packetBuffer.size();
+            pair.second.stats.bytesSent += packetBuffer.size();
+        }
+    }
+
+    // bWew⤺ݰe tile ]ƭӫʥ]
+    void SendPending(HSteamNetConnection conn, ClientState& client, int budget) {
+        uint8_t tileData[MAX_TILE_BYTES];
+
+        while (client.nextPending < client.pendingTiles.size() && budget > 0) {
+            packetBuffer.resize(sizeof(PacketSplatUpdate));
+            uint16_t tileCount = 0;
+
+            while (client.nextPending < client.pendingTiles.size()) {
+                int tileIndex = client.pendingTiles[client.nextPending];
+                SplatTileEncoding encoding;
+                int bytes = EncodeTile(map->coverage, tileIndex, tileData, encoding);
+
+                size_t needed = sizeof(SplatTileHeader) + bytes;
+                if (tileCount > 0 && packetBuffer.size() + needed > (size_t)maxPacketBytes) break;
+
+                SplatTileHeader tile;
+                tile.tileIndex = (uint16_t)tileIndex;
+                tile.encoding = encoding;
+                tile.byteCount = (uint16_t)bytes;
+
+                size_t offset = packetBuffer.size();
+                packetBuffer.resize(offset + needed);
+                memcpy(packetBuffer.data() + offset, &tile, sizeof(tile));
+                memcpy(packetBuffer.data() + offset + sizeof(tile), tileData, bytes);
+
+                tileCount++;
+                client.nextPending++;
+            }
+
+            PacketSplatUpdate header;
+            header.header.type = PacketType::S2C_SPLAT_UPDATE;
+            header.mapVersion = map->GetVersion();
+            header.tileCount = tileCount;
+            memcpy(packetBuffer.data(), &header, sizeof(header));
+
+            NetworkManager::Instance().Send(conn, packetBuffer.data(), packetBuffer.size(), true);
+
+            budget -= (int)packetBuffer.size();
+            client.bytesWindow += packetBuffer.size();
+            client.stats.bytesSent += packetBuffer.size();
+            client.stats.tilesSent += tileCount;
+        }
+
+        if (client.nextPending >= client.pendingTiles.size()) {
+            client.pendingTiles.clear();
+            client.nextPending = 0;
+        }
+    }
+};
\ No newline at end of file
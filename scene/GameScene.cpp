@@ -38,6 +38,7 @@ void GameScene::OnExit() {
     std::cout << "[Scene] Exit GameScene" << std::endl;
 
     CurrentCamera = nullptr;
+    interpolator.Clear();
 
     glfwSetInputMode(glfwGetCurrentContext(), GLFW_CURSOR, GLFW_CURSOR_NORMAL);
 
@@ -54,6 +55,12 @@ void GameScene::OnExit() {
 // game update
 void GameScene::Update(float dt) {
     if (!world) return;
+
+    // OUo tick em (۾۷ƹƥ󨫡Aum)
+    interpolator.Clear();
+    world->CaptureRenderState(interpolator);
+    if (cameraObj) interpolator.Capture(cameraObj->transform, false);
+
     world->Update(dt);
     if (hud) hud->Update(dt);
     if (scoreboard) scoreboard->Update(dt);
@@ -106,9 +113,12 @@ void GameScene::Update(float dt) {
 }
 
 // Render loop
-void GameScene::Render() {
+void GameScene::Render(float alpha) {
     if (!world || !shader || !CurrentCamera) return;
 
+    // eɭԴmAe^A
+    interpolator.Apply(alpha);
+
     glViewport(0, 0, 1280, 720);
     glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -119,11 +129,13 @@ void GameScene::Render() {
     shader->SetVec3("viewPos", cameraObj->transform->position);
 
     // draw world
-    world->Render(*shader, CurrentCamera);
+    world->Render(*shader, CurrentCamera, alpha);
 
     // draw UI
     if (hud) hud->Draw(*shader);
     if (scoreboard) scoreboard->Draw(*shader);
+
+    interpolator.Restore();
 }
 
 // ImGui UI
@@ -190,6 +202,12 @@ void GameScene::DrawUI() {
         }
 
         scoreboard->DrawPlayerIcons(playerStatuses);
+
+        if (world->minimap) {
+            std::vector<MinimapMarker> markers;
+            world->GetMinimapMarkers(markers);
+            hud->DrawMinimap(world->minimap->GetTextureID(), markers);
+        }
         scoreboard->DrawUITimer(world->gameTimeRemaining);
     }
     else if (world->state == WorldState::FINISHED) {
@@ -203,7 +221,8 @@ void GameScene::DrawUI() {
             world->finalScoreTeam1,
             world->finalScoreTeam2,
             myTeam,
-            animTime
+            animTime,
+            world->finalPlayerTurf
         );
     }
 }
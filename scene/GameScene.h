@@ -5,6 +5,7 @@
 #include "../engine/scene/Scene.h"
 #include "../engine/scene/SceneManager.h"
 #include "../engine/GameObject.h"
+#include "../engine/TransformInterpolator.h"
 #include "../engine/core/Input.h"
 #include "../gameplay/GameWorld.h"
 #include "../components/Camera.h"
@@ -35,11 +36,11 @@ public:
     // exit scene
     void OnExit() override;
 
-    // game update
+    // game update (CөTw tick @)
     void Update(float dt) override;
 
-    // Render loop
-    void Render() override;
+    // Render loop (alpha = ebW@ tick M̷s tick m)
+    void Render(float alpha) override;
 
     void DrawUI() override;
 
@@ -48,4 +49,5 @@ public:
 
 private:
     bool isExited = false;
+    TransformInterpolator interpolator; // C tick }lemARender ɤ
 };
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// d׳ (XZ îl)ALevel::Load ئnclM𤧫MH@
+// NCd߳LҦê AABBG
+//   GetHeightAtGŪҦblסAO(1)AcltO (cltl)
+//   RaycastGuuqblW DDA (Amanatides & Woo)AuuqugLlACTסA|TwB@˸L
+//            (hG BLOCK x BLOCK jlAuqCNβӨ)
+//
+// uܡuqaXӪWlv(C@Ӱ)AaŪF詳U]ߡFثeduaclM
+// u RaycastAi GetHeightAt (b䤣|QbW)
+class HeightField {
+public:
+    static constexpr int BLOCK = 8;
+
+    // d [min, max] (@ɮy x, z)Aks (aO)
+    void Reset(const glm::vec2& min, const glm::vec2& max, float cellSize) {
+        origin = min;
+        this->cellSize = cellSize;
+        invCellSize = 1.0f / cellSize;
+        width = std::max(1, (int)std::ceil((max.x - min.x) * invCellSize));
+        depth = std::max(1, (int)std::ceil((max.y - min.y) * invCellSize));
+        cells.assign((size_t)width * depth, 0.0f);
+        ground.assign((size_t)width * depth, 0.0f);
+        blocksX = (width + BLOCK - 1) / BLOCK;
+        blocksZ = (depth + BLOCK - 1) / BLOCK;
+        blocks.assign((size_t)blocksX * blocksZ, 0.0f);
+    }
+
+    //  AABB (, b) 쪺a԰쥦
+    // standable = falseGu RaycastAGetHeightAt ݤ ()
+    void AddBox(const glm::vec3& center, const glm::vec3& halfExtents, bool standable = true) {
+        float top = center.y + halfExtents.y;
+        float x0 = (center.x - halfExtents.x - origin.x) * invCellSize, x1 = (center.x + halfExtents.x - origin.x) * invCellSize;
+        float z0 = (center.z - halfExtents.z - origin.y) * invCellSize, z1 = (center.z + halfExtents.z - origin.y) * invCellSize;
+
+        // cl| (tuI) lAר̰
+        int cx0 = std::max(0, (int)std::floor(x0)), cx1 = std::min(width - 1, (int)std::ceil(x1) - 1);
+        int cz0 = std::max(0, (int)std::floor(z0)), cz1 = std::min(depth - 1, (int)std::ceil(z1) - 1);
+        for (int z = cz0; z <= cz1; z++) {
+            for (int x = cx0; x <= cx1; x++) {
+                size_t i = (size_t)z * width + x;
+                cells[i] = std::max(cells[i], top);
+                if (standable) ground[i] = std::max(ground[i], top);
+                float& block = blocks[(size_t)(z / BLOCK) * blocksX + x / BLOCK];
+                block = std::max(block, top);
+            }
+        }
+    }
+
+    // Ҧbl (u standable cl)Ad~ = aO (0)
+    float GetHeightAt(float x, float z) const {
+        float gx = (x - origin.x) * invCellSize, gz = (z - origin.y) * invCellSize;
+        if (ground.empty() || gx < 0.0f || gz < 0.0f || gx >= (float)width || gz >= (float)depth) return 0.0f;
+        return ground[(size_t)gz * width + (size_t)gx];
+    }
+
+    // uq a -> b Ĥ@Ia (CҦblסAάLaO y = 0) mAt = 0 ~ 1
+    // b BLOCK x BLOCK 檺jlWAuqboӤjl̳L̰INL
+    bool Raycast(const glm::vec3& a, const glm::vec3& b, float& t) const {
+        glm::vec3 d = b - a;
+        float best = 2.0f;
+
+        // l~uaO
+        if (d.y < 0.0f && b.y < 0.0f) best = std::max(0.0f, a.y / -d.y);
+
+        // uqbld򤺪@q [tIn, tOut] (XZ  slab)
+        float gx = (a.x - origin.x) * invCellSize, gz = (a.z - origin.y) * invCellSize;
+        float dx = d.x * invCellSize, dz = d.z * invCellSize;
+        float tIn = 0.0f, tOut = std::min(best, 1.0f);
+        if (cells.empty() || !ClipSlab(gx, dx, (float)width, tIn, tOut) || !ClipSlab(gz, dz, (float)depth, tIn, tOut)) {
+            return Finish(best, t);
+        }
+
+        const float invBlock = 1.0f / BLOCK;
+        Traverse(gx * invBlock, gz * invBlock, dx * invBlock, dz * invBlock, blocksX, blocksZ, tIn, tOut,
+            [&](int bx, int bz, float t0, float t1) {
+                float yMin = std::min(a.y + d.y * t0, a.y + d.y * t1);
+                if (yMin >= blocks[(size_t)bz * blocksX + bx]) return false;
+
+                return Traverse(gx, gz, dx, dz, width, depth, t0, t1, [&](int cx, int cz, float c0, float c1) {
+                    float h = cells[(size_t)cz * width + cx];
+                    if (a.y + d.y * c0 < h) {
+                        // qio@ (Τ@}lNb̭)
+                        best = std::min(best, c0);
+                        return true;
+                    }
+                    if (a.y + d.y * c1 < h) {
+                        // qWio@檺
+                        best = std::min(best, (h - a.y) / d.y);
+                        return true;
+                    }
+                    return false;
+                });
+            });
+        return Finish(best, t);
+    }
+
+    bool HasLineOfSight(const glm::vec3& a, const glm::vec3& b) const {
+        float t;
+        return !Raycast(a, b, t);
+    }
+
+    float GetCellSize() const { return cellSize; }
+    int GetWidth() const { return width; }
+    int GetDepth() const { return depth; }
+
+private:
+    glm::vec2 origin = glm::vec2(0.0f);
+    float cellSize = 1.0f, invCellSize = 1.0f;
+    int width = 0, depth = 0;
+    std::vector<float> cells;    // C̰ [z * width + x] (Raycast ΡAt)
+    std::vector<float> ground;   // CiH [z * width + x] (GetHeightAt ΡAt)
+    std::vector<float> blocks;   // C BLOCK x BLOCK ̳̰ (Raycast Lma)
+    int blocksX = 0, blocksZ = 0;
+
+    // p + dp * t b [0, size]  t ϶A [tIn, tOut] 涰
+    static bool ClipSlab(float p, float dp, float size, float& tIn, float& tOut) {
+        if (dp == 0.0f) return p >= 0.0f && p <= size;
+        float t0 = (0.0f - p) / dp, t1 = (size - p) / dp;
+        if (t0 > t1) std::swap(t0, t1);
+        tIn = std::max(tIn, t0);
+        tOut = std::min(tOut, t1);
+        return tIn <= tOut;
+    }
+
+    // ly (H欰) uq p + dp * tA̧ǨL [tIn, tOut] gLC@ (Amanatides & Woo)
+    // visit(x, z, iJ t, } t) ^ true NATraverse ]^ true
+    template <typename Visit>
+    static bool Traverse(float px, float pz, float dx, float dz, int w, int h, float tIn, float tOut, Visit visit) {
+        // _Il (ΰ϶@IImMwAקKnbɤW)
+        float tStart = tIn + (tOut - tIn) * 1e-4f;
+        int x = std::clamp((int)std::floor(px + dx * tStart), 0, w - 1);
+        int z = std::clamp((int)std::floor(pz + dz * tStart), 0, h - 1);
+
+        int stepX = (dx > 0.0f) ? 1 : -1, stepZ = (dz > 0.0f) ? 1 : -1;
+        float tDeltaX = (dx != 0.0f) ? std::abs(1.0f / dx) : 1e30f;
+        float tDeltaZ = (dz != 0.0f) ? std::abs(1.0f / dz) : 1e30f;
+        float tMaxX = (dx != 0.0f) ? ((x + (stepX > 0 ? 1 : 0)) - px) / dx : 1e30f;
+        float tMaxZ = (dz != 0.0f) ? ((z + (stepZ > 0 ? 1 : 0)) - pz) / dz : 1e30f;
+
+        float tCur = tIn;
+        for (;;) {
+            float tNext = std::min(std::min(tMaxX, tMaxZ), tOut);
+            if (visit(x, z, tCur, tNext)) return true;
+            if (tNext >= tOut) return false;
+
+            if (tMaxX < tMaxZ) {
+                x += stepX;
+                tMaxX += tDeltaX;
+            }
+            else {
+                z += stepZ;
+                tMaxZ += tDeltaZ;
+            }
+            if (x < 0 || z < 0 || x >= w || z >= h) return false;
+            tCur = tNext;
+        }
+    }
+
+    static bool Finish(float best, float& t) {
+        if (best > 1.0f) return false;
+        t = best;
+        return true;
+    }
+};
\ No newline at end of file
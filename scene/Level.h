@@ -1,15 +1,36 @@
 #pragma once
 #include <vector>
+#include <string>
 #include <iostream>
+#include <cmath>
+#include <array>
 #include "Entity.h"
 #include "FloorMesh.h"
 #include "../engine/rendering/Texture.h"
+#include "../gameplay/LevelGeometry.h"
+#include "../splat/SplatSurfaceAtlas.h"
+#include "HeightField.h"
+#include "LevelBVH.h"
 
 class Level {
 public:
     FloorMesh* floor;
     std::vector<Entity*> walls;
     std::vector<Entity*> obstacles;
+
+    // iHRA (𤺰PBêU)
+    // u쾥aϦaOU誺 surface atlasAaO@ΦP@ia
+    // walls / obstacles ud۷IơAeWeo mesh (uv = a uv)
+    SplatSurfaceAtlas surfaceAtlas;
+    std::vector<Entity*> paintSurfaces;
+
+    //  + êMH׳ (׬dߡBpgBuPw)
+    HeightField heightField;
+    float heightFieldCellSize = 0.25f; // cltb 0.5 m ƤWAlɭn
+
+    //  + ê AABB  (luI)Acls =  walls A obstacles
+    LevelBVH collision;
+    std::vector<std::array<int, LevelGeometry::BOX_SIDES>> boxFaces; // [cl][LevelGeometry::SideIndex] -> surfaceAtlas  (-1 = )
     std::shared_ptr<Texture> floorTex;
     std::shared_ptr<Texture> wallTex;
 
@@ -24,6 +45,14 @@ public:
     glm::vec3 spawnPointTeam2 = glm::vec3(0, 25.0f, 40.0f);
     glm::vec3 landingPointTeam2 = glm::vec3(0, 0.5f, 40.0f);
 
+    // ϰ (mIҦ / AI aL / HUD ϰ)A@ɮy XZ Wx
+    struct Zone {
+        std::string name;
+        glm::vec2 min; // (x, z)
+        glm::vec2 max;
+    };
+    std::vector<Zone> zones;
+
     void Load() {
         // 1. J
         floorTex = std::make_shared<Texture>();
@@ -73,6 +102,57 @@ public:
 
         // x
         CreateBox(glm::vec3(0, 1.0f, 0), glm::vec3(6, 2, 6));
+
+        BakeHeightField();
+        BuildCollision();
+
+        // 5. ϰ
+        AddZone("Center", glm::vec2(0.0f, 0.0f), glm::vec2(16.0f, 16.0f));
+        AddZone("RedBase", glm::vec2(0.0f, -32.0f), glm::vec2(24.0f, 16.0f));
+        AddZone("GreenBase", glm::vec2(0.0f, 32.0f), glm::vec2(24.0f, 16.0f));
+    }
+
+    // sW@ӥH centerXZ ߡBsizeXZ jpϰA^ǰϰs
+    int AddZone(const std::string& name, glm::vec2 centerXZ, glm::vec2 sizeXZ) {
+        zones.push_back({ name, centerXZ - sizeXZ * 0.5f, centerXZ + sizeXZ * 0.5f });
+        return (int)zones.size() - 1;
+    }
+
+    int FindZone(const std::string& name) const {
+        for (int i = 0; i < (int)zones.size(); i++) {
+            if (zones[i].name == name) return i;
+        }
+        return -1;
+    }
+
+    // ̾aϦaOѪR (texel) iHƶi atlasAëإ߹ mesh
+    // ᾥaϭnh surfaceAtlas.GetRows() Coǭ
+    void BuildPaintSurfaces(int floorTexels) {
+        for (auto s : paintSurfaces) delete s;
+        paintSurfaces.clear();
+        surfaceAtlas.Reset(floorTexels, mapSize);
+        std::array<int, LevelGeometry::BOX_SIDES> noFaces;
+        noFaces.fill(-1);
+        boxFaces.assign(walls.size() + obstacles.size(), noFaces);
+        size_t box = 0;
+
+        // u¤Mݱo
+        std::vector<LevelVertex> wallVerts;
+        for (auto w : walls) {
+            glm::vec3 pos = w->transform->position;
+            int inner;
+            if (std::abs(pos.z) > std::abs(pos.x)) inner = (pos.z < 0.0f) ? LevelGeometry::FACE_FRONT : LevelGeometry::FACE_BACK;
+            else inner = (pos.x < 0.0f) ? LevelGeometry::FACE_RIGHT : LevelGeometry::FACE_LEFT;
+            LevelGeometry::AddBox(wallVerts, surfaceAtlas, pos, w->transform->scale * 0.5f, LevelGeometry::FACE_TOP | inner, boxFaces[box++].data());
+        }
+
+        std::vector<LevelVertex> boxVerts;
+        for (auto o : obstacles) {
+            LevelGeometry::AddBox(boxVerts, surfaceAtlas, o->transform->position, o->transform->scale * 0.5f, LevelGeometry::FACE_ALL, boxFaces[box++].data());
+        }
+
+        AddPaintSurface(wallVerts, glm::vec3(1.0f));
+        AddPaintSurface(boxVerts, glm::vec3(0.6f, 0.6f, 0.6f)); // Ǧcl
     }
 
     // [sW] V禡 (Τ@޲zVAKǤJ mapSize  Shader)
@@ -88,56 +168,83 @@ public:
             floor->Draw(shader);
         }
 
-        // 2. e (q`ܾAiH useInk)
-        shader.SetInt("useInk", 0);
-        for (auto w : walls) {
-            w->Draw(shader);
-        }
-
-        // 3. eê (ênܾA} useInk)
+        // 2. ePê (b surface atlas WA} useInk)
         shader.SetInt("useInk", 1);
-        for (auto o : obstacles) {
-            o->Draw(shader);
+        for (auto s : paintSurfaces) {
+            s->Draw(shader);
         }
     }
 
-    // [sW] ²檺׬d (FtX Player z)
-    float GetHeightAt(float x, float z) {
-        // ]OaAj^ 0
-        // pGn Player WclAiHbo²M obstacles
-
-        for (auto box : obstacles) {
-            glm::vec3 pos = box->transform->position;
-            glm::vec3 scale = box->transform->scale;
-
-            // AABB ˬd
-            float halfW = scale.x / 2.0f;
-            float halfD = scale.z / 2.0f;
-
-            if (x >= pos.x - halfW && x <= pos.x + halfW &&
-                z >= pos.z - halfD && z <= pos.z + halfD) {
-                // pGbcld򤺡A^ǽcl (pos.y + halfHeight)
-                // Cube ҫ׬O 2? ٬O 1? ] Cube IbߡA׽d -1~1
-                // o̰]ڭY᪺ڰ׬O scale.y
-                // cl = pos.y + (scale.y / 2.0f) * 1.0f (]ҫ׬1)  *2.0f (]ҫ׬2)
-                // ھڧAe Entity CubeAq`O 2 (-1~1)
-                // ҥH = pos.y + scale.y; (pG scale=1, pos=0, =1)
-                return pos.y + scale.y;
-            }
-        }
+    // MêئnIs (FclnsMH)
+    // d]t (aϥ~ 1 m p)AAhd@
+    void BakeHeightField() {
+        float half = mapSize / 2.0f + 1.0f + heightFieldCellSize;
+        heightField.Reset(glm::vec2(-half), glm::vec2(half), heightFieldCellSize);
+        // u׹pgMuAⰪ (b٬OaO)
+        for (auto w : walls) heightField.AddBox(w->transform->position, w->transform->scale * 0.5f, false);
+        // Cube ҫO -0.5 ~ 0.5AҥH = pos.y + scale.y / 2
+        for (auto o : obstacles) heightField.AddBox(o->transform->position, o->transform->scale * 0.5f);
+    }
 
-        return 0.0f; // aO
+    // Mê AABB  ( BakeHeightField @ˡAFcln)
+    void BuildCollision() {
+        std::vector<LevelBVH::Box> boxes;
+        auto add = [&](Entity* e) {
+            glm::vec3 half = e->transform->scale * 0.5f;
+            boxes.push_back({ e->transform->position - half, e->transform->position + half });
+        };
+        for (auto w : walls) add(w);
+        for (auto o : obstacles) add(o);
+        collision.Build(boxes);
+    }
+
+    // lu쪺@b surfaceAtlas Ws (-1 = o@AҦp~)
+    int GetHitFace(const LevelBVH::Hit& hit) const {
+        int side = LevelGeometry::SideIndex(hit.normal);
+        if (hit.box < 0 || hit.box >= (int)boxFaces.size() || side < 0) return -1;
+        return boxFaces[hit.box][side];
+    }
+
+    // ׬d (ҦblclA𤣺AO(1))
+    float GetHeightAt(float x, float z) const {
+        return heightField.GetHeightAt(x, z);
+    }
+
+    // uq a -> b Ĥ@a (clBBaO) mAt = 0 ~ 1
+    bool Raycast(const glm::vec3& a, const glm::vec3& b, float& t) const {
+        return heightField.Raycast(a, b, t);
+    }
+
+    bool HasLineOfSight(const glm::vec3& a, const glm::vec3& b) const {
+        return heightField.HasLineOfSight(a, b);
     }
 
     void CleanUp() {
         if (floor) delete floor;
         for (auto w : walls) delete w;
         for (auto o : obstacles) delete o;
+        for (auto s : paintSurfaces) delete s;
         walls.clear();
         obstacles.clear();
+        paintSurfaces.clear();
+        zones.clear();
     }
 
 private:
+    void AddPaintSurface(const std::vector<LevelVertex>& verts, const glm::vec3& color) {
+        if (verts.empty()) return;
+
+        std::vector<Vertex> meshVerts;
+        meshVerts.reserve(verts.size());
+        for (const auto& v : verts) meshVerts.push_back({ v.position, v.uv, v.normal });
+
+        Entity* surface = new Entity("PaintSurface");
+        surface->AddComponent<MeshRenderer>(std::make_shared<Mesh>(meshVerts), color);
+        // uv HaOe׬ 1AaO@˨C 5 حƤ@
+        if (wallTex) surface->GetComponent<MeshRenderer>()->SetTexture(wallTex, mapSize / 5.0f);
+        paintSurfaces.push_back(surface);
+    }
+
     void CreateBox(glm::vec3 pos, glm::vec3 scale) {
         Entity* box = new Entity("Box");
         box->transform->position = pos;
@@ -0,0 +1,211 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+// RA ( + ê)  AABB ALevel::Load ؤ@
+// luC@BLy (swept sphere) ҦclDĤ@ӸIIAclƶq log AOu
+//
+// y AABB Ρucl~X radiusv (Minkowski M~)GWTA䨤|@III (̦h 0.73 x radius)
+class LevelBVH {
+public:
+    static constexpr int LEAF_SIZE = 2;
+
+    struct Box {
+        glm::vec3 min, max;
+    };
+
+    struct SweepQuery {
+        glm::vec3 from, to;
+        float radius;
+    };
+
+    struct Hit {
+        int box = -1;        // Build ɶǤJǡA-1 = SI
+        float t = 1.0f;      // uqWm (0 ~ 1)
+        glm::vec3 normal;    // I쪺@¥~ku (b)
+        glm::vec3 point;     // clWĲI (yߦb t ɳ̾aI)
+    };
+
+    void Build(const std::vector<Box>& input) {
+        boxes = input;
+        nodes.clear();
+        order.resize(boxes.size());
+        for (size_t i = 0; i < order.size(); i++) order[i] = (int)i;
+        if (boxes.empty()) return;
+
+        nodes.reserve(boxes.size() * 2);
+        nodes.push_back({});
+        Subdivide(0, 0, (int)boxes.size());
+    }
+
+    bool Empty() const { return boxes.empty(); }
+    size_t GetBoxCount() const { return boxes.size(); }
+    const Box& GetBox(int i) const { return boxes[i]; }
+
+    // y (b| radius) u from -> to ʡAĤ@ӸI쪺cl
+    bool SweepSphere(const glm::vec3& from, const glm::vec3& to, float radius, Hit& hit) const {
+        hit.box = -1;
+        hit.t = 1.0f;
+        if (nodes.empty()) return false;
+
+        glm::vec3 d = to - from;
+        glm::vec3 invD(SafeInverse(d.x), SafeInverse(d.y), SafeInverse(d.z));
+        float best = 1.0f;
+        int bestAxis = 0;
+
+        // stack s`IMiJI tAbest Yu t `ILAΦA@
+        int stack[64];
+        float stackT[64];
+        int top = 0;
+        int axis;
+        float tRoot;
+        if (!SlabTest(from, invD, nodes[0].min - radius, nodes[0].max + radius, best, tRoot, axis)) return false;
+        stack[top] = 0;
+        stackT[top++] = tRoot;
+        while (top > 0) {
+            --top;
+            if (hit.box >= 0 && stackT[top] >= best) continue;
+            const Node& node = nodes[stack[top]];
+
+            if (node.count > 0) {
+                for (int k = node.first; k < node.first + node.count; k++) {
+                    const Box& b = boxes[order[k]];
+                    float t;
+                    if (SlabTest(from, invD, b.min - radius, b.max + radius, best, t, axis) && (hit.box < 0 || t < best)) {
+                        best = t;
+                        bestAxis = axis;
+                        hit.box = order[k];
+                    }
+                }
+                continue;
+            }
+
+            // 񪺤l`I (i stack )Abest Yuỷӱ``iHӸL
+            int left = node.first, right = node.first + 1;
+            float tLeft, tRight;
+            bool hitLeft = SlabTest(from, invD, nodes[left].min - radius, nodes[left].max + radius, best, tLeft, axis);
+            bool hitRight = SlabTest(from, invD, nodes[right].min - radius, nodes[right].max + radius, best, tRight, axis);
+            if (hitLeft && hitRight && tLeft <= tRight) {
+                std::swap(left, right);
+                std::swap(tLeft, tRight);
+            }
+            if (hitLeft) {
+                stack[top] = left;
+                stackT[top++] = tLeft;
+            }
+            if (hitRight) {
+                stack[top] = right;
+                stackT[top++] = tRight;
+            }
+        }
+
+        if (hit.box < 0) return false;
+
+        const Box& b = boxes[hit.box];
+        glm::vec3 center = from + d * best;
+        hit.t = best;
+        hit.point = glm::clamp(center, b.min, b.max);
+        hit.normal = glm::vec3(0.0f);
+        if (best > 0.0f) {
+            hit.normal[bestAxis] = (d[bestAxis] > 0.0f) ? -1.0f : 1.0f;
+        }
+        else {
+            // @}lN|Gyߦbcl~N̪񪺨@VAb̭N̪񪺭
+            glm::vec3 offset = center - hit.point;
+            glm::vec3 toMin = center - b.min, toMax = b.max - center;
+            float bestScore = -1e30f;
+            for (int i = 0; i < 3; i++) {
+                float outside = std::abs(offset[i]);
+                float score = (outside > 0.0f) ? outside : -std::min(toMin[i], toMax[i]);
+                if (score > bestScore) {
+                    bestScore = score;
+                    hit.normal = glm::vec3(0.0f);
+                    hit.normal[i] = (outside > 0.0f) ? (offset[i] > 0.0f ? 1.0f : -1.0f) : (toMin[i] < toMax[i] ? -1.0f : 1.0f);
+                }
+            }
+        }
+        return true;
+    }
+
+    // @ (o@VҦ椤lu)Ahits[i]  queries[i]
+    void SweepSpheres(const std::vector<SweepQuery>& queries, std::vector<Hit>& hits) const {
+        hits.resize(queries.size());
+        for (size_t i = 0; i < queries.size(); i++) {
+            SweepSphere(queries[i].from, queries[i].to, queries[i].radius, hits[i]);
+        }
+    }
+
+private:
+    struct Node {
+        glm::vec3 min, max;
+        int first; // `IGorder _IF`IGl`I (k = first + 1)
+        int count; // `IclơA`I = 0
+    };
+
+    std::vector<Box> boxes;
+    std::vector<Node> nodes;
+    std::vector<int> order;
+
+    // ѤWUGuI̪bqƤ}
+    void Subdivide(int nodeIndex, int begin, int end) {
+        glm::vec3 lo(1e30f), hi(-1e30f), cLo(1e30f), cHi(-1e30f);
+        for (int k = begin; k < end; k++) {
+            const Box& b = boxes[order[k]];
+            lo = glm::min(lo, b.min);
+            hi = glm::max(hi, b.max);
+            glm::vec3 c = (b.min + b.max) * 0.5f;
+            cLo = glm::min(cLo, c);
+            cHi = glm::max(cHi, c);
+        }
+        nodes[nodeIndex].min = lo;
+        nodes[nodeIndex].max = hi;
+
+        if (end - begin <= LEAF_SIZE) {
+            nodes[nodeIndex].first = begin;
+            nodes[nodeIndex].count = end - begin;
+            return;
+        }
+
+        glm::vec3 extent = cHi - cLo;
+        int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : (extent.y >= extent.z ? 1 : 2);
+        int mid = (begin + end) / 2;
+        std::nth_element(order.begin() + begin, order.begin() + mid, order.begin() + end, [&](int a, int b) {
+            return boxes[a].min[axis] + boxes[a].max[axis] < boxes[b].min[axis] + boxes[b].max[axis];
+        });
+
+        int left = (int)nodes.size();
+        nodes.push_back({});
+        nodes.push_back({});
+        nodes[nodeIndex].first = left;
+        nodes[nodeIndex].count = 0;
+        Subdivide(left, begin, mid);
+        Subdivide(left + 1, mid, end);
+    }
+
+    static float SafeInverse(float v) {
+        return (std::abs(v) > 1e-12f) ? 1.0f / v : (v < 0.0f ? -1e30f : 1e30f);
+    }
+
+    // uq from + d * t (t = 0 ~ maxT)  AABB Ĥ@ӥIF_Ib̭ t = 0
+    // axis = q@Ӷbih
+    static bool SlabTest(const glm::vec3& from, const glm::vec3& invD, const glm::vec3& lo, const glm::vec3& hi,
+                         float maxT, float& t, int& axis) {
+        float tEnter = 0.0f, tExit = maxT;
+        axis = 0;
+        for (int i = 0; i < 3; i++) {
+            float t0 = (lo[i] - from[i]) * invD[i];
+            float t1 = (hi[i] - from[i]) * invD[i];
+            if (t0 > t1) std::swap(t0, t1);
+            if (t0 > tEnter) {
+                tEnter = t0;
+                axis = i;
+            }
+            tExit = std::min(tExit, t1);
+            if (tEnter > tExit) return false;
+        }
+        t = tEnter;
+        return true;
+    }
+};
\ No newline at end of file
@@ -29,7 +29,7 @@ public:
         // nJeSC޿ns
     }
 
-    void Render() override {
+    void Render(float alpha) override {
         glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
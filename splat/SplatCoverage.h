@@ -0,0 +1,638 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <emmintrin.h>
+#define SPLAT_COVERAGE_SSE2 1
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// CPU ݪл\ (ѪR׻P ink texture ۦP)
+// C texel  2 bits sG0:L, 1:, 2: (3 Od)
+// @ uint64_t s 32  texelA@C word Bz
+// Ƥs (PAGE_SIZE x PAGE_SIZE)AĤ@gJɤ~tmAOuLn
+class SplatCoverage {
+public:
+    static constexpr int TEXELS_PER_WORD = 32;
+
+    // 32x32  tileGen@ wordA 32 C
+    static constexpr int TILE_SIZE = 32;
+
+    // splat_01.png  alpha >= 0.5 ϰ촫⦨nꪺb| (۹ Quad be)
+    // ŪKϮ SplatStampLibrary γoӶΪ
+    static constexpr float SPLAT_SHAPE_RADIUS = 0.54f;
+
+    // @ 128x128 texelG@C 4  wordAn 4x4  tile
+    static constexpr int PAGE_SIZE = 128;
+    static constexpr int PAGE_WORDS = PAGE_SIZE / TEXELS_PER_WORD;
+
+    int width, height;
+    int wordsPerRow;
+
+    // GStm (nullptr) 㭶O 0
+    int pagesX, pagesY;
+    std::vector<std::unique_ptr<uint64_t[]>> pages;     // C PAGE_SIZE C x PAGE_WORDS  word
+    std::vector<std::unique_ptr<uint8_t[]>> ownerPages; // C PAGE_SIZE x PAGE_SIZE  byte (EnableOwners ~)
+    std::vector<int> pageSlots;      // page -> tm (-1 = Stm)AGPU atlas ΦP@Ӷ
+    std::vector<int> allocatedPages; // ̰tmǱƦC page
+
+    // Uثe texel  (0 = S)ACgJɥηs­Ȯtq@
+    int64_t teamTexels[4];
+
+    // Ϊ̹ϼh (EnableOwners() ~tm)GC texel @ byte sa slot (0 = L/)
+    // ownerTexels[slot]  teamTexels @˦bgJɦQ\
+    bool ownersEnabled = false;
+    int64_t ownerTexels[256];
+
+    // gJd (SetClip)Aw]ia
+    int clipX0, clipY0, clipX1, clipY1;
+
+    // Dirty tile l
+    // version  BeginBatch() WAgJɧI쪺 tile Цثe version
+    // LtΰOWݨ쪺 versionA GetTilesChangedSince() t
+    int tilesX, tilesY;
+    uint32_t version = 0;
+    std::vector<uint32_t> tileVersions;
+    std::vector<uint64_t> dirtyBits;   // W ConsumeDirtyTiles() QL tile
+
+    // tile hash ֨ (gJɧ@o)
+    mutable std::vector<uint32_t> tileHashes;
+    mutable std::vector<uint8_t> tileHashValid;
+
+    SplatCoverage(int w, int h) : width(w), height(h) {
+        ResetClip();
+        wordsPerRow = (w + TEXELS_PER_WORD - 1) / TEXELS_PER_WORD;
+        pagesX = (w + PAGE_SIZE - 1) / PAGE_SIZE;
+        pagesY = (h + PAGE_SIZE - 1) / PAGE_SIZE;
+        pages.resize((size_t)pagesX * pagesY);
+        ownerPages.resize((size_t)pagesX * pagesY);
+        pageSlots.assign((size_t)pagesX * pagesY, -1);
+        ResetCounters();
+
+        tilesX = wordsPerRow;
+        tilesY = (h + TILE_SIZE - 1) / TILE_SIZE;
+        tileVersions.assign((size_t)tilesX * tilesY, 0);
+        dirtyBits.assign(((size_t)tilesX * tilesY + 63) / 64, 0);
+        tileHashes.assign((size_t)tilesX * tilesY, 0);
+        tileHashValid.assign((size_t)tilesX * tilesY, 0);
+    }
+
+    // MŨҦ
+    void Clear() {
+        for (auto& page : pages) page.reset();
+        for (auto& page : ownerPages) page.reset();
+        std::fill(pageSlots.begin(), pageSlots.end(), -1);
+        allocatedPages.clear();
+        ResetCounters();
+
+        BeginBatch();
+        for (int i = 0; i < tilesX * tilesY; i++) MarkTile(i);
+    }
+
+    // }l@sgJ (Ҧp SplatPainter @ Flush)A^ǳo媺 version
+    uint32_t BeginBatch() {
+        return ++version;
+    }
+
+    uint32_t GetVersion() const { return version; }
+    int GetTileCount() const { return tilesX * tilesY; }
+    uint32_t GetTileVersion(int tile) const { return tileVersions[tile]; }
+
+    // ^ version j sinceVersion  tile index (ѥWkU)
+    void GetTilesChangedSince(uint32_t sinceVersion, std::vector<int>& outTiles) const {
+        outTiles.clear();
+        for (int i = 0; i < (int)tileVersions.size(); i++) {
+            if (tileVersions[i] > sinceVersion) outTiles.push_back(i);
+        }
+    }
+
+    // XòM dirty bitset (CVuݤ@tΡAҦpKϧW)
+    void ConsumeDirtyTiles(std::vector<int>& outTiles) {
+        outTiles.clear();
+        for (size_t i = 0; i < dirtyBits.size(); i++) {
+            uint64_t bits = dirtyBits[i];
+            while (bits) {
+                int bit = LowestBit(bits);
+                outTiles.push_back((int)(i * 64 + bit));
+                bits &= bits - 1;
+            }
+            dirtyBits[i] = 0;
+        }
+    }
+
+    bool HasDirtyTiles() const {
+        for (uint64_t bits : dirtyBits) if (bits) return true;
+        return false;
+    }
+
+    // tile  texel d (x, y, w, h)Ak/Uɪ tile ip
+    void GetTileRect(int tile, int& x, int& y, int& w, int& h) const {
+        x = (tile % tilesX) * TILE_SIZE;
+        y = (tile / tilesX) * TILE_SIZE;
+        w = std::min(TILE_SIZE, width - x);
+        h = std::min(TILE_SIZE, height - y);
+    }
+
+    int64_t GetTeamTexels(int team) const {
+        return (team >= 0 && team < 4) ? teamTexels[team] : 0;
+    }
+
+    // }lOC texel Oֶ (e slot 0)
+    void EnableOwners() {
+        if (ownersEnabled) return;
+        ownersEnabled = true;
+        for (int page : allocatedPages) ownerPages[page].reset(new uint8_t[PAGE_SIZE * PAGE_SIZE]());
+        ResetOwnerCounters();
+    }
+
+    bool HasOwners() const { return ownersEnabled; }
+
+    int GetOwner(int x, int y) const {
+        if (!ownersEnabled || x < 0 || x >= width || y < 0 || y >= height) return 0;
+        const uint8_t* o = ownerPages[PageOf(x, y)].get();
+        return o ? o[(y % PAGE_SIZE) * PAGE_SIZE + x % PAGE_SIZE] : 0;
+    }
+
+    // ---  ---
+    int GetPageCount() const { return pagesX * pagesY; }
+    int PageOf(int x, int y) const { return (y / PAGE_SIZE) * pagesX + x / PAGE_SIZE; }
+    bool IsPageAllocated(int page) const { return pages[page] != nullptr; }
+    int GetPageSlot(int page) const { return pageSlots[page]; }
+    const std::vector<int>& GetAllocatedPages() const { return allocatedPages; }
+
+    // wtm@ (GPU neioɥ)
+    void EnsurePage(int page) {
+        if (!pages[page]) AllocatePage(page);
+    }
+
+    // ثeƦΪO (bytes)
+    size_t GetPageMemory() const {
+        size_t perPage = PAGE_SIZE * PAGE_WORDS * sizeof(uint64_t) + (ownersEnabled ? PAGE_SIZE * PAGE_SIZE : 0);
+        return allocatedPages.size() * perPage + pages.size() * sizeof(pages[0]) * 2;
+    }
+
+    //  y C w  word (Stm^ 0)
+    uint64_t ReadWord(int y, int w) const {
+        const uint64_t* page = pages[(y / PAGE_SIZE) * pagesX + w / PAGE_WORDS].get();
+        return page ? page[(y % PAGE_SIZE) * PAGE_WORDS + w % PAGE_WORDS] : 0;
+    }
+
+    int64_t GetOwnerTexels(int slot) const {
+        return (slot >= 0 && slot < 256) ? ownerTexels[slot] : 0;
+    }
+
+    int64_t GetTotalTexels() const {
+        return (int64_t)width * height;
+    }
+
+    int Get(int x, int y) const {
+        if (x < 0 || x >= width || y < 0 || y >= height) return 0;
+        uint64_t w = ReadWord(y, x / TEXELS_PER_WORD);
+        return (int)((w >> ((x % TEXELS_PER_WORD) * 2)) & 3);
+    }
+
+    int GetUV(float u, float v) const {
+        return Get((int)std::floor(u * width), (int)std::floor(v * height));
+    }
+
+    // ᪺gJub [x0, x1] x [y0, y1] (t) AҦpu surface atlas WY@
+    void SetClip(int x0, int y0, int x1, int y1) {
+        clipX0 = std::max(x0, 0); clipY0 = std::max(y0, 0);
+        clipX1 = std::min(x1, width - 1); clipY1 = std::min(y1, height - 1);
+    }
+
+    void ResetClip() { SetClip(0, 0, width - 1, height - 1); }
+
+    //  [x0, x1] (t) oq texel  teamAowner O slot (} EnableOwners ~O)
+    void FillSpan(int y, int x0, int x1, int team, uint8_t owner = 0) {
+        if (y < clipY0 || y > clipY1) return;
+        x0 = std::max(x0, clipX0);
+        x1 = std::min(x1, clipX1);
+        if (x0 > x1) return;
+
+        // q
+        for (int px = x0 / PAGE_SIZE; px <= x1 / PAGE_SIZE; px++) {
+            FillPageSpan(y, std::max(x0, px * PAGE_SIZE), std::min(x1, px * PAGE_SIZE + PAGE_SIZE - 1), team, owner);
+        }
+    }
+
+
+    // H texel yеe߶ (CC@ sqrtAAq)
+    // PwIO texel  (x + 0.5, y + 0.5)
+    void FillDisc(float cx, float cy, float radius, int team, uint8_t owner = 0) {
+        int y0 = (int)std::ceil(cy - radius - 0.5f);
+        int y1 = (int)std::floor(cy + radius - 0.5f);
+        float r2 = radius * radius;
+
+        for (int y = std::max(y0, 0); y <= std::min(y1, height - 1); y++) {
+            float dy = (y + 0.5f) - cy;
+            float h2 = r2 - dy * dy;
+            if (h2 < 0.0f) continue;
+            float half = std::sqrt(h2);
+            int x0 = (int)std::ceil(cx - half - 0.5f);
+            int x1 = (int)std::floor(cx + half - 0.5f);
+            FillSpan(y, x0, x1, team, owner);
+        }
+    }
+
+    // n (uq a-b ~X radius)Atexel y
+    // nOYAC@C涰@wO@qGݶPxΦboCpd
+    void FillCapsule(float ax, float ay, float bx, float by, float radius, int team, uint8_t owner = 0) {
+        float dx = bx - ax, dy = by - ay;
+        float len = std::sqrt(dx * dx + dy * dy);
+        if (len < 1e-4f) {
+            FillDisc(ax, ay, radius, team, owner);
+            return;
+        }
+        dx /= len;
+        dy /= len;
+        float r2 = radius * radius;
+
+        int y0 = (int)std::ceil(std::min(ay, by) - radius - 0.5f);
+        int y1 = (int)std::floor(std::max(ay, by) + radius - 0.5f);
+
+        for (int y = std::max(y0, 0); y <= std::min(y1, height - 1); y++) {
+            float py = y + 0.5f;
+            float xMin = 1e30f, xMax = -1e30f;
+
+            // ݪ
+            const float ends[2][2] = { { ax, ay }, { bx, by } };
+            for (int e = 0; e < 2; e++) {
+                float ey = py - ends[e][1];
+                float h2 = r2 - ey * ey;
+                if (h2 < 0.0f) continue;
+                float half = std::sqrt(h2);
+                xMin = std::min(xMin, ends[e][0] - half);
+                xMax = std::max(xMax, ends[e][0] + half);
+            }
+
+            // x: 0 <= (p-a)Pd <= len, |(p-a)Pn| <= radius, n = (-dy, dx)
+            // ӱ x OuʪAU۸ѥX x dA涰
+            float lo = -1e30f, hi = 1e30f;
+            float ry = py - ay;
+            if (!ClipLinear(dx, dy * ry, 0.0f, len, ax, lo, hi) ||
+                !ClipLinear(-dy, dx * ry, -radius, radius, ax, lo, hi)) {
+                lo = 1e30f; hi = -1e30f;
+            }
+            if (lo <= hi) {
+                xMin = std::min(xMin, lo);
+                xMax = std::max(xMax, hi);
+            }
+
+            if (xMin > xMax) continue;
+            FillSpan(y, (int)std::ceil(xMin - 0.5f), (int)std::floor(xMax - 0.5f), team, owner);
+        }
+    }
+
+    // 1-bit mask (SplatStampLibrary 榡GCC wordsPerRow  uint32Abit i =  i  texel)
+    // Ub (x0, y0)ACCs 1 XӾq
+    void FillMask(int x0, int y0, int diameter, int wordsPerRow, const uint32_t* rows, int team, uint8_t owner = 0) {
+        for (int r = 0; r < diameter; r++) {
+            int y = y0 + r;
+            if (y < clipY0 || y > clipY1) continue;
+            const uint32_t* row = rows + (size_t)r * wordsPerRow;
+
+            int x = NextMaskBit(row, wordsPerRow, 0, true);
+            while (x < diameter) {
+                int end = std::min(NextMaskBit(row, wordsPerRow, x, false), diameter);
+                FillSpan(y, x0 + x, x0 + end - 1, team, owner);
+                x = NextMaskBit(row, wordsPerRow, end, true);
+            }
+        }
+    }
+
+    // νd򤺬O_ texel ݩ team
+    bool AnyInDisc(float cx, float cy, float radius, int team) const {
+        if (team <= 0 || team > 3) return false;
+        int y0 = (int)std::ceil(cy - radius - 0.5f);
+        int y1 = (int)std::floor(cy + radius - 0.5f);
+        float r2 = radius * radius;
+        const uint64_t pattern = Replicate(team);
+
+        for (int y = std::max(y0, 0); y <= std::min(y1, height - 1); y++) {
+            float dy = (y + 0.5f) - cy;
+            float h2 = r2 - dy * dy;
+            if (h2 < 0.0f) continue;
+            float half = std::sqrt(h2);
+            int x0 = std::max((int)std::ceil(cx - half - 0.5f), 0);
+            int x1 = std::min((int)std::floor(cx + half - 0.5f), width - 1);
+            if (x0 > x1) continue;
+
+            for (int w = x0 / TEXELS_PER_WORD; w <= x1 / TEXELS_PER_WORD; w++) {
+                uint64_t m = ~0ull;
+                if (w == x0 / TEXELS_PER_WORD) m &= HeadMask(x0 % TEXELS_PER_WORD);
+                if (w == x1 / TEXELS_PER_WORD) m &= TailMask(x1 % TEXELS_PER_WORD);
+                if (MatchMask(ReadWord(y, w), pattern) & m) return true;
+            }
+        }
+        return false;
+    }
+
+    // o tile  row C (32  texel n@ word)AWXaϪC^ 0
+    uint64_t GetTileRow(int tile, int row) const {
+        int y = (tile / tilesX) * TILE_SIZE + row;
+        if (y >= height) return 0;
+        return ReadWord(y, tile % tilesX);
+    }
+
+    // Cмg (PB)Aeܤ~gJüаO tileA^ǬO_
+    bool SetTileRow(int tile, int row, uint64_t value) {
+        int y = (tile / tilesX) * TILE_SIZE + row;
+        if (y >= height) return false;
+
+        int tx = tile % tilesX;
+        uint64_t mask = ~0ull;
+        if (tx == tilesX - 1) mask = TailMask((width - 1) % TEXELS_PER_WORD);
+
+        if ((ReadWord(y, tx) & mask) == (value & mask)) return false;
+
+        int page = PageOf(tx * TEXELS_PER_WORD, y);
+        EnsurePage(page);
+        uint64_t& w = pages[page][(y % PAGE_SIZE) * PAGE_WORDS + tx % PAGE_WORDS];
+
+        // PBLӪƤDOֶAܤF texel 令 slot 0
+        if (ownersEnabled) {
+            uint64_t diff = (w ^ value) & mask;
+            uint64_t changed = (diff | (diff >> 1)) & LOW_BITS;
+            uint8_t* o = &ownerPages[page][(y % PAGE_SIZE) * PAGE_SIZE + (tx * TEXELS_PER_WORD) % PAGE_SIZE];
+            while (changed) {
+                int i = LowestBit(changed) / 2;
+                ownerTexels[o[i]]--;
+                ownerTexels[0]++;
+                o[i] = 0;
+                changed &= changed - 1;
+            }
+        }
+
+        // C texel PAҥHvBz
+        Uncount(w, mask);
+        uint64_t v = value & mask;
+        uint64_t lo = v & LOW_BITS;
+        uint64_t hi = (v >> 1) & LOW_BITS;
+        uint64_t fields = mask & LOW_BITS;
+        teamTexels[1] += PopCount(lo & ~hi);
+        teamTexels[2] += PopCount(hi & ~lo);
+        teamTexels[3] += PopCount(lo & hi);
+        teamTexels[0] += PopCount(fields & ~(lo | hi));
+        w = (w & ~mask) | v;
+
+        MarkTile(tile);
+        return true;
+    }
+
+    // tile e hash (32  row word ̧ǲVX)AݸƬۦPN@wۦP
+    uint32_t GetTileHash(int tile) const {
+        if (tileHashValid[tile]) return tileHashes[tile];
+
+        uint64_t h = 0x9E3779B97F4A7C15ull ^ (uint64_t)tile;
+        for (int r = 0; r < TILE_SIZE; r++) {
+            h ^= GetTileRow(tile, r);
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 32;
+        }
+        tileHashes[tile] = (uint32_t)h;
+        tileHashValid[tile] = 1;
+        return tileHashes[tile];
+    }
+
+    // iaϪ hash (Ҧ tile hash AVX@)
+    uint32_t GetMapHash() const {
+        uint32_t h = 2166136261u;
+        for (int i = 0; i < GetTileCount(); i++) {
+            h = (h ^ GetTileHash(i)) * 16777619u;
+        }
+        return h;
+    }
+
+    // ϭsέpU texel  (counts[0..3])AO(N)AuΨҭpƾ
+    void CountTeams(int64_t counts[4]) const {
+        counts[0] = counts[1] = counts[2] = counts[3] = 0;
+        for (int page : allocatedPages) {
+            const uint64_t* data = pages[page].get();
+            for (int i = 0; i < PAGE_SIZE * PAGE_WORDS; i++) {
+                uint64_t lo = data[i] & LOW_BITS;
+                uint64_t hi = (data[i] >> 1) & LOW_BITS;
+                counts[1] += PopCount(lo & ~hi);
+                counts[2] += PopCount(hi & ~lo);
+                counts[3] += PopCount(lo & hi);
+            }
+        }
+        // WXaϽd padding ûO 0
+        counts[0] = (int64_t)width * height - counts[1] - counts[2] - counts[3];
+    }
+
+    // pƾPϭ⵲G@Ph^ true
+    bool ValidateCounters() const {
+        int64_t counts[4];
+        CountTeams(counts);
+        for (int t = 0; t < 4; t++) {
+            if (counts[t] != teamTexels[t]) return false;
+        }
+
+        if (ownersEnabled) {
+            // uƦaϽd򤺪 texelAStm slot 0
+            int64_t ownerCounts[256] = {};
+            ownerCounts[0] = (int64_t)width * height;
+            for (int page : allocatedPages) {
+                const uint8_t* o = ownerPages[page].get();
+                int x0 = (page % pagesX) * PAGE_SIZE, y0 = (page / pagesX) * PAGE_SIZE;
+                int w = std::min(PAGE_SIZE, width - x0), h = std::min(PAGE_SIZE, height - y0);
+                for (int y = 0; y < h; y++) {
+                    for (int x = 0; x < w; x++) {
+                        ownerCounts[o[y * PAGE_SIZE + x]]++;
+                        ownerCounts[0]--;
+                    }
+                }
+            }
+            for (int i = 0; i < 256; i++) {
+                if (ownerCounts[i] != ownerTexels[i]) return false;
+            }
+        }
+        return true;
+    }
+
+    static constexpr uint64_t LOW_BITS = 0x5555555555555555ull;
+
+    static uint64_t Replicate(int team) {
+        return LOW_BITS * (uint64_t)(team & 3);
+    }
+
+    // C 2-bit Y pattern hbC줸^ 1
+    static uint64_t MatchMask(uint64_t w, uint64_t pattern) {
+        uint64_t diff = w ^ pattern;
+        return ~(diff | (diff >> 1)) & LOW_BITS;
+    }
+
+    static int LowestBit(uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, v);
+        return (int)index;
+#elif defined(__GNUC__)
+        return __builtin_ctzll(v);
+#else
+        int i = 0;
+        while (!(v & 1)) { v >>= 1; i++; }
+        return i;
+#endif
+    }
+
+    // q from }lĤ@ӵ value  bit (䤣^ wordsPerRow * 32)
+    static int NextMaskBit(const uint32_t* row, int wordsPerRow, int from, bool value) {
+        int w = from / 32;
+        if (w >= wordsPerRow) return wordsPerRow * 32;
+        uint32_t bits = (value ? row[w] : ~row[w]) & (~0u << (from % 32));
+        while (!bits) {
+            if (++w == wordsPerRow) return wordsPerRow * 32;
+            bits = value ? row[w] : ~row[w];
+        }
+        return w * 32 + LowestBit(bits);
+    }
+
+    static int PopCount(uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return (int)__popcnt64(v);
+#elif defined(__GNUC__)
+        return __builtin_popcountll(v);
+#else
+        int c = 0;
+        while (v) { v &= v - 1; c++; }
+        return c;
+#endif
+    }
+
+private:
+    // FillSpan @q (x0, x1 bP@)
+    void FillPageSpan(int y, int x0, int x1, int team, uint8_t owner) {
+        int page = PageOf(x0, y);
+        if (!pages[page]) {
+            if (team == 0) return; // SAΰtm
+            AllocatePage(page);
+        }
+
+        if (ownersEnabled) WriteOwners(page, y, x0, x1, team > 0 ? owner : 0);
+
+        // row[i] = o@Cb i  word ( word = wBase + i)
+        int wBase = (x0 / PAGE_SIZE) * PAGE_WORDS;
+        uint64_t* row = pages[page].get() + (y % PAGE_SIZE) * PAGE_WORDS;
+        const uint64_t pattern = Replicate(team);
+
+        int w0 = x0 / TEXELS_PER_WORD;
+        int w1 = x1 / TEXELS_PER_WORD;
+        for (int w = w0; w <= w1; w++) MarkTile((y / TILE_SIZE) * tilesX + w);
+        w0 -= wBase;
+        w1 -= wBase;
+
+        uint64_t headMask = HeadMask(x0 % TEXELS_PER_WORD);
+        uint64_t tailMask = TailMask(x1 % TEXELS_PER_WORD);
+
+        if (w0 == w1) {
+            WriteMasked(row[w0], headMask & tailMask, pattern, team);
+            return;
+        }
+
+        WriteMasked(row[w0], headMask, pattern, team);
+
+        // q word л\GªpơAAqgJ
+        int full = w1 - w0 - 1;
+        for (int i = 1; i <= full; i++) Uncount(row[w0 + i], ~0ull);
+        teamTexels[team & 3] += (int64_t)full * TEXELS_PER_WORD;
+        FillWords(row + w0 + 1, full, pattern);
+
+        WriteMasked(row[w1], tailMask, pattern, team);
+    }
+
+    void AllocatePage(int page) {
+        pages[page].reset(new uint64_t[PAGE_SIZE * PAGE_WORDS]());
+        if (ownersEnabled) ownerPages[page].reset(new uint8_t[PAGE_SIZE * PAGE_SIZE]());
+        pageSlots[page] = (int)allocatedPages.size();
+        allocatedPages.push_back(page);
+    }
+
+    //  minV <= k * (x - x0) + c <= maxV Ѧ x dAP [lo, hi] 涰
+    static bool ClipLinear(float k, float c, float minV, float maxV, float x0, float& lo, float& hi) {
+        if (std::fabs(k) < 1e-6f) return c >= minV && c <= maxV;
+        float t0 = (minV - c) / k + x0;
+        float t1 = (maxV - c) / k + x0;
+        if (t0 > t1) std::swap(t0, t1);
+        lo = std::max(lo, t0);
+        hi = std::min(hi, t1);
+        return lo <= hi;
+    }
+
+    void MarkTile(int tile) {
+        tileVersions[tile] = version;
+        dirtyBits[tile / 64] |= 1ull << (tile % 64);
+        tileHashValid[tile] = 0;
+    }
+
+    void ResetCounters() {
+        teamTexels[0] = (int64_t)width * height;
+        teamTexels[1] = teamTexels[2] = teamTexels[3] = 0;
+        ResetOwnerCounters();
+    }
+
+    void ResetOwnerCounters() {
+        std::fill(ownerTexels, ownerTexels + 256, 0);
+        ownerTexels[0] = ownersEnabled ? (int64_t)width * height : 0;
+    }
+
+    // ª̡AAqg owner
+    void WriteOwners(int page, int y, int x0, int x1, uint8_t owner) {
+        uint8_t* o = &ownerPages[page][(y % PAGE_SIZE) * PAGE_SIZE + x0 % PAGE_SIZE];
+        int count = x1 - x0 + 1;
+        for (int i = 0; i < count; i++) ownerTexels[o[i]]--;
+        ownerTexels[owner] += count;
+        std::memset(o, owner, count);
+    }
+
+    //  word  mask d򤺪­ȱqpƾ (mask H 2-bit 쬰)
+    void Uncount(uint64_t w, uint64_t mask) {
+        uint64_t fields = mask & LOW_BITS;
+        uint64_t lo = w & fields;
+        uint64_t hi = (w >> 1) & fields;
+        int c1 = PopCount(lo & ~hi);
+        int c2 = PopCount(hi & ~lo);
+        int c3 = PopCount(lo & hi);
+        teamTexels[0] -= PopCount(fields) - c1 - c2 - c3;
+        teamTexels[1] -= c1;
+        teamTexels[2] -= c2;
+        teamTexels[3] -= c3;
+    }
+
+    void WriteMasked(uint64_t& w, uint64_t mask, uint64_t pattern, int team) {
+        Uncount(w, mask);
+        teamTexels[team & 3] += PopCount(mask & LOW_BITS);
+        w = (w & ~mask) | (pattern & mask);
+    }
+
+    // q i  texel (t)  word 
+    static uint64_t HeadMask(int i) {
+        return ~0ull << (i * 2);
+    }
+
+    // q word }Y i  texel (t)
+    static uint64_t TailMask(int i) {
+        return (i == TEXELS_PER_WORD - 1) ? ~0ull : ((1ull << ((i + 1) * 2)) - 1);
+    }
+
+    // q word OP@ӭȡA@g 128 bits
+    static void FillWords(uint64_t* dst, int count, uint64_t pattern) {
+        int i = 0;
+#ifdef SPLAT_COVERAGE_SSE2
+        __m128i v = _mm_set1_epi64x((long long)pattern);
+        for (; i + 2 <= count; i += 2) {
+            _mm_storeu_si128((__m128i*)(dst + i), v);
+        }
+#endif
+        for (; i < count; i++) dst[i] = pattern;
+    }
+};
\ No newline at end of file
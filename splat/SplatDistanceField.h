@@ -0,0 +1,162 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "SplatCoverage.h"
+
+// UZ (chamfer 3-4)Au̪񪺾hvܦ@d
+// H CELL_SIZE x CELL_SIZE  texel @Al̥un@ texel OӶN⦳
+// ZH 1/3 欰s uint8AWL MAX_CELLS @߷@uܻv
+// u SplatCoverage ܰʪ tile U۩~X MAX_CELLS 檺d
+// C tile @ӽdAd| (ά۾F) ~X֡AaϨݦPɶ|ܦi
+class SplatDistanceField {
+public:
+    static constexpr int CELL_SIZE = 4;
+    static constexpr int MAX_CELLS = 32;
+    static constexpr uint8_t FAR_VALUE = 3 * MAX_CELLS;
+
+    static constexpr int TEAM_COUNT = 2;
+
+    int cellsX, cellsY;
+
+    SplatDistanceField(int texWidth, int texHeight) {
+        cellsX = (texWidth + CELL_SIZE - 1) / CELL_SIZE;
+        cellsY = (texHeight + CELL_SIZE - 1) / CELL_SIZE;
+        for (int t = 0; t < TEAM_COUNT; t++) fields[t].assign((size_t)cellsX * cellsY, FAR_VALUE);
+    }
+
+    // W coverage ̷s (Sܮɤ򳣤)
+    void Refresh(const SplatCoverage& coverage) {
+        if (built && coverage.GetVersion() == builtVersion) return;
+
+        windows.clear();
+        if (!built) {
+            windows.push_back({ 0, 0, cellsX - 1, cellsY - 1 });
+        }
+        else {
+            changedTiles.clear();
+            coverage.GetTilesChangedSince(builtVersion, changedTiles);
+
+            // Z̦hǼ MAX_CELLS Ad~ȤvTAiHɱ
+            const int cellsPerTile = SplatCoverage::TILE_SIZE / CELL_SIZE;
+            for (int tile : changedTiles) {
+                int tx = (tile % coverage.tilesX) * cellsPerTile;
+                int ty = (tile / coverage.tilesX) * cellsPerTile;
+                AddWindow({ std::max(tx - MAX_CELLS, 0), std::max(ty - MAX_CELLS, 0),
+                    std::min(tx + cellsPerTile - 1 + MAX_CELLS, cellsX - 1), std::min(ty + cellsPerTile - 1 + MAX_CELLS, cellsY - 1) });
+            }
+        }
+
+        lastRebuildCells = 0;
+        for (const Window& w : windows) {
+            for (int t = 0; t < TEAM_COUNT; t++) Rebuild(coverage, t + 1, w.x0, w.y0, w.x1, w.y1);
+            lastRebuildCells += (w.x1 - w.x0 + 1) * (w.y1 - w.y0 + 1);
+        }
+
+        built = true;
+        builtVersion = coverage.GetVersion();
+    }
+
+    // texel y (x, y) ̪ team 檺Z (texel)AWXd^ GetMaxDistance()
+    float GetDistance(int team, float x, float y) const {
+        if (team < 1 || team > TEAM_COUNT) return GetMaxDistance();
+        int cx = std::clamp((int)(x / CELL_SIZE), 0, cellsX - 1);
+        int cy = std::clamp((int)(y / CELL_SIZE), 0, cellsY - 1);
+        return fields[team - 1][(size_t)cy * cellsX + cx] * (CELL_SIZE / 3.0f);
+    }
+
+    float GetMaxDistance() const { return FAR_VALUE * (CELL_SIZE / 3.0f); }
+
+    // W@ Refresh ⪺l / d (į[)
+    int GetLastRebuildCells() const { return lastRebuildCells; }
+    int GetLastRebuildWindows() const { return (int)windows.size(); }
+
+private:
+    std::vector<uint8_t> fields[TEAM_COUNT];
+    std::vector<int> changedTiles;
+
+    struct Window {
+        int x0, y0, x1, y1; // ly (t)
+    };
+    std::vector<Window> windows;
+    bool built = false;
+    uint32_t builtVersion = 0;
+    int lastRebuildCells = 0;
+
+    // [i@ӽdAwd|ά۾FNX (X֫iSIOAҥHs)
+    // ۾F]nX֡G@ӽd򪺥~Ot@ӽdɱAO٨S⪺­
+    void AddWindow(Window w) {
+        for (size_t i = 0; i < windows.size();) {
+            const Window& o = windows[i];
+            if (w.x0 <= o.x1 + 1 && o.x0 <= w.x1 + 1 && w.y0 <= o.y1 + 1 && o.y0 <= w.y1 + 1) {
+                w = { std::min(w.x0, o.x0), std::min(w.y0, o.y0), std::max(w.x1, o.x1), std::max(w.y1, o.y1) };
+                windows[i] = windows.back();
+                windows.pop_back();
+                i = 0;
+                continue;
+            }
+            i++;
+        }
+        windows.push_back(w);
+    }
+
+    bool CellHasInk(const SplatCoverage& coverage, uint64_t pattern, int cx, int cy) const {
+        int x = cx * CELL_SIZE;
+        int shift = (x % SplatCoverage::TEXELS_PER_WORD) * 2;
+        uint64_t cellMask = ((1ull << (CELL_SIZE * 2)) - 1) << shift;
+        int w = x / SplatCoverage::TEXELS_PER_WORD;
+
+        int yEnd = std::min((cy + 1) * CELL_SIZE, coverage.height);
+        for (int y = cy * CELL_SIZE; y < yEnd; y++) {
+            uint64_t word = coverage.ReadWord(y, w);
+            if (SplatCoverage::MatchMask(word, pattern) & cellMask) return true;
+        }
+        return false;
+    }
+
+    //  chamferGd򤺭sءAd~@骺­ȷ@Tw
+    void Rebuild(const SplatCoverage& coverage, int team, int x0, int y0, int x1, int y1) {
+        uint8_t* d = fields[team - 1].data();
+        const uint64_t pattern = SplatCoverage::Replicate(team);
+
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                d[(size_t)cy * cellsX + cx] = CellHasInk(coverage, pattern, cx, cy) ? 0 : FAR_VALUE;
+            }
+        }
+
+        // kUGݥBWBWBkW
+        for (int cy = y0; cy <= y1; cy++) {
+            uint8_t* row = d + (size_t)cy * cellsX;
+            const uint8_t* up = (cy > 0) ? row - cellsX : nullptr;
+            for (int cx = x0; cx <= x1; cx++) {
+                int v = row[cx];
+                if (v == 0) continue;
+                if (cx > 0) v = std::min(v, row[cx - 1] + 3);
+                if (up) {
+                    v = std::min(v, up[cx] + 3);
+                    if (cx > 0) v = std::min(v, up[cx - 1] + 4);
+                    if (cx + 1 < cellsX) v = std::min(v, up[cx + 1] + 4);
+                }
+                row[cx] = (uint8_t)std::min(v, (int)FAR_VALUE);
+            }
+        }
+
+        // WGݥkBkUBUBU
+        for (int cy = y1; cy >= y0; cy--) {
+            uint8_t* row = d + (size_t)cy * cellsX;
+            const uint8_t* down = (cy + 1 < cellsY) ? row + cellsX : nullptr;
+            for (int cx = x1; cx >= x0; cx--) {
+                int v = row[cx];
+                if (v == 0) continue;
+                if (cx + 1 < cellsX) v = std::min(v, row[cx + 1] + 3);
+                if (down) {
+                    v = std::min(v, down[cx] + 3);
+                    if (cx + 1 < cellsX) v = std::min(v, down[cx + 1] + 4);
+                    if (cx > 0) v = std::min(v, down[cx - 1] + 4);
+                }
+                row[cx] = (uint8_t)std::min(v, (int)FAR_VALUE);
+            }
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include <cstdint>
+#include "../engine/rendering/Shader.h"
+
+// GPU έpGCompute Shader XU texel ƻPC tile ƶq
+// Ggi@սyϥΪ bufferA fence T{ GPU ~Ū^ADjû| GPU
+class SplatHistogram {
+public:
+    static const int TILE_SIZE = 32;   // P coverage.comp  local_size ۦP
+    static const int RING_SIZE = 3;
+
+    struct Result {
+        bool valid = false;
+        uint32_t teamTexels[4] = { 0, 0, 0, 0 };
+        std::vector<uint32_t> tileCounts; // C tile : , 
+        int64_t submitIndex = -1;         // ĴX Submit G
+    };
+
+    SplatHistogram(int w, int h) : width(w), height(h) {
+        tilesX = (w + TILE_SIZE - 1) / TILE_SIZE;
+        tilesY = (h + TILE_SIZE - 1) / TILE_SIZE;
+        bufferSize = sizeof(uint32_t) * (4 + (size_t)tilesX * tilesY * 2);
+
+        computeShader = new Shader("assets/shaders/coverage.comp");
+
+        for (int i = 0; i < RING_SIZE; i++) {
+            glGenBuffers(1, &slots[i].buffer);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, slots[i].buffer);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, bufferSize, NULL, GL_DYNAMIC_READ);
+        }
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        latest.tileCounts.assign((size_t)tilesX * tilesY * 2, 0);
+    }
+
+    ~SplatHistogram() {
+        for (int i = 0; i < RING_SIZE; i++) {
+            if (slots[i].fence) glDeleteSync(slots[i].fence);
+            glDeleteBuffers(1, &slots[i].buffer);
+        }
+        delete computeShader;
+    }
+
+    // eX@έpCU@٦b GPU NLo (^ false)
+    // inkFormat P SplatMap  InkFormat ƭȬۦP
+    bool Submit(unsigned int inkTexture, int inkFormat) {
+        Slot& slot = slots[nextSlot];
+        if (slot.fence) return false;
+
+        // u`ƻݭnksAtile ƶqC|Qмg
+        uint32_t zero = 0;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, slot.buffer);
+        glClearBufferSubData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, 0, sizeof(uint32_t) * 4, GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, slot.buffer);
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, inkTexture);
+
+        computeShader->Bind();
+        computeShader->SetInt("inkFormat", inkFormat);
+        glDispatchCompute(tilesX, tilesY, 1);
+
+        // ᪺ glGetBufferSubData ݱo shader gJG
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        slot.submitIndex = submitCount++;
+
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        nextSlot = (nextSlot + 1) % RING_SIZE;
+        return true;
+    }
+
+    // ˬdw fence (timeout 0A|d)AsG^ true
+    bool Poll() {
+        bool updated = false;
+        for (int i = 0; i < RING_SIZE; i++) {
+            Slot& slot = slots[i];
+            if (!slot.fence) continue;
+
+            GLenum status = glClientWaitSync(slot.fence, 0, 0);
+            if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) continue;
+
+            glDeleteSync(slot.fence);
+            slot.fence = 0;
+
+            // ثeW´NŪF
+            if (slot.submitIndex <= latest.submitIndex) continue;
+
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, slot.buffer);
+            glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(uint32_t) * 4, latest.teamTexels);
+            glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, sizeof(uint32_t) * 4, bufferSize - sizeof(uint32_t) * 4, latest.tileCounts.data());
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+            latest.valid = true;
+            latest.submitIndex = slot.submitIndex;
+            updated = true;
+        }
+        return updated;
+    }
+
+    const Result& GetLatest() const { return latest; }
+
+    int GetTilesX() const { return tilesX; }
+    int GetTilesY() const { return tilesY; }
+
+private:
+    struct Slot {
+        unsigned int buffer = 0;
+        GLsync fence = 0;
+        int64_t submitIndex = -1;
+    };
+
+    int width, height;
+    int tilesX, tilesY;
+    size_t bufferSize;
+
+    Shader* computeShader;
+    Slot slots[RING_SIZE];
+    int nextSlot = 0;
+    int64_t submitCount = 0;
+
+    Result latest;
+};
\ No newline at end of file
@@ -4,25 +4,65 @@
 #include <vector>
 #include <cmath>
 #include <algorithm>
+#include <string>
+#include <cstdint>
+#include <map>
+#include "SplatCoverage.h"
+#include "SplatHistogram.h"
+#include "SplatDistanceField.h"
+#include "SplatZoneTable.h"
+#include "SplatStampLibrary.h"
+#include "../engine/core/Logger.h"
 
+// KϪxs榡 (ƭȻP default.frag / coverage.comp  inkFormat ۦP)
+enum class InkFormat {
+    RGBA8 = 0,  // sC + alpha
+    RG8   = 1,  // R: ( - 1) / 2 x л\v, G: л\v (iHuʤ)
+    R8    = 2   // s / 3AM CPU  SplatCoverage @@ (shader ۤv)
+};
+
+// uv GxBy Haϼe׬ 1AaOO [0,1]^2
+// aϤeװɭԡAhXӪCO SplatSurfaceAtlas (Bcl)Ab v > 1 a
 class SplatMap {
 public:
     unsigned int fbo;
-    unsigned int textureID;
+    unsigned int textureID;   // }ҦUO魶 atlas
     int width, height;
+    InkFormat format;
+
+    // aO uv dASplatPainter Swd򪺾u|bo
+    inline static const glm::vec4 FLOOR_CLIP = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+
+    // }ҦGuL (SplatCoverage::PAGE_SIZE ) ~b GPU atlas Wm
+    // default.frag έ (pageTableIDAR16UIA0 = StmA_h atlas slot + 1)  texel b atlas m
+    // C|Phd PAGE_GUTTER  texel sFAuʤ| atlas Wۤz
+    bool sparse;
+    unsigned int pageTableID = 0;
+    static constexpr int PAGE_GUTTER = 1;
+    static constexpr int ATLAS_PAGES_X = 32;
+    static constexpr int PAGE_STRIDE = SplatCoverage::PAGE_SIZE + 2 * PAGE_GUTTER;
+
+    //  1~3 C (RG8 / R8  default.frag d)
+    glm::vec3 teamPalette[3] = { glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), glm::vec3(0, 0, 1) };
 
     // CPU ޿a (ΩPwPֳtCd)
-    static const int GRID_SIZE = 100;
-    int gridData[GRID_SIZE][GRID_SIZE]; // 0:L, 1:, 2:
+    // ѪR׻PKϬۦPAC texel s 0:L, 1:, 2:
+    SplatCoverage coverage;
 
-    SplatMap(int w, int h) : width(w), height(h) {
+    // Debug ΡGCdߤƮɥΥϭҼWqpƾ
+    bool debugValidateCounters = false;
+
+    SplatMap(int w, int h, InkFormat format = InkFormat::RGBA8, bool sparse = false)
+        : width(w), height(h), format(format), sparse(sparse), coverage(w, h), inkDistance(w, h), zoneTable(w, h) {
         InitFBO();
         ClearCPUData();
     }
 
     ~SplatMap() {
+        delete histogram;
         glDeleteFramebuffers(1, &fbo);
         glDeleteTextures(1, &textureID);
+        if (pageTableID) glDeleteTextures(1, &pageTableID);
     }
 
     void BindTexture(int slot) const {
@@ -30,83 +70,349 @@ public:
         glBindTexture(GL_TEXTURE_2D, textureID);
     }
 
-    void UpdateCPUData(float u, float v, int teamID, int radius = 2) {
-        int cx = (int)(u * GRID_SIZE);
-        int cy = (int)(v * GRID_SIZE);
+    void BindPageTable(int slot) const {
+        glActiveTexture(GL_TEXTURE0 + slot);
+        glBindTexture(GL_TEXTURE_2D, pageTableID);
+    }
 
-        for (int x = cx - radius; x <= cx + radius; x++) {
-            for (int y = cy - radius; y <= cy + radius; y++) {
-                if (x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE) {
-                    gridData[x][y] = teamID;
-                }
+    // uv -> KϮy (0~1) YA shader 
+    glm::vec2 GetUVScale() const { return glm::vec2(1.0f, (float)width / height); }
+
+    // pGiH texel  (aO + atlas WAw]ia)
+    void SetPaintableTexels(int64_t texels) { paintableTexels = texels; }
+    int64_t GetPaintableTexels() const { return paintableTexels > 0 ? paintableTexels : coverage.GetTotalTexels(); }
+
+    int GetAtlasWidth() const { return ATLAS_PAGES_X * PAGE_STRIDE; }
+    int GetAtlasHeight() const { return atlasPagesY * PAGE_STRIDE; }
+
+    // GPU ݾƪjp (bytes)
+    size_t GetTextureMemory() const {
+        int channels = (format == InkFormat::RGBA8) ? 4 : (format == InkFormat::RG8) ? 2 : 1;
+        if (!sparse) return (size_t)width * height * channels;
+        return (size_t)GetAtlasWidth() * GetAtlasHeight() * channels + pageTableData.size() * sizeof(uint16_t);
+    }
+
+    // --- }Ҧ ---
+
+    // uv dI쪺AwithGutter = true ɧ令ugutter IBӥBwgtmv (\ne)
+    void CollectPages(const glm::vec2& uvMin, const glm::vec2& uvMax, bool withGutter, std::vector<int>& out) const {
+        const int pad = withGutter ? PAGE_GUTTER : 0;
+        int x0 = std::max((int)std::floor(uvMin.x * width) - pad, 0);
+        int y0 = std::max((int)std::floor(uvMin.y * width) - pad, 0);
+        int x1 = std::min((int)std::floor(uvMax.x * width) + pad, width - 1);
+        int y1 = std::min((int)std::floor(uvMax.y * width) + pad, height - 1);
+        if (x0 > x1 || y0 > y1) return;
+
+        const int P = SplatCoverage::PAGE_SIZE;
+        for (int py = y0 / P; py <= y1 / P; py++) {
+            for (int px = x0 / P; px <= x1 / P; px++) {
+                int page = py * coverage.pagesX + px;
+                if (!withGutter || coverage.IsPageAllocated(page)) out.push_back(page);
             }
         }
     }
 
-    // eePwGˬdYӦmPO_SwC
-    bool IsColorInArea(float u, float v, int teamID, int radius = 1) {
-        int cx = (int)(u * GRID_SIZE);
-        int cy = (int)(v * GRID_SIZE);
+    // tm CPU AAPB GPU atlas P (GPU neiseIs)
+    void EnsurePagesResident(const std::vector<int>& pageList) {
+        for (int page : pageList) coverage.EnsurePage(page);
+        SyncPages();
+    }
 
-        for (int x = cx - radius; x <= cx + radius; x++) {
-            for (int y = cy - radius; y <= cy + radius; y++) {
-                if (x >= 0 && x < GRID_SIZE && y >= 0 && y < GRID_SIZE) {
-                    if (gridData[x][y] == teamID) return true;
-                }
+    // wtmb atlas WU (t gutter)
+    void AtlasOrigin(int page, int& x, int& y) const {
+        int slot = coverage.GetPageSlot(page);
+        x = (slot % ATLAS_PAGES_X) * PAGE_STRIDE + PAGE_GUTTER;
+        y = (slot / ATLAS_PAGES_X) * PAGE_STRIDE + PAGE_GUTTER;
+    }
+
+    //  uv (NDC) yФܴNeiY@Gviewport ob atlas mAscissor bo (t gutter)
+    void SetPageViewport(int page) const {
+        int slot = coverage.GetPageSlot(page);
+        int ox = (slot % ATLAS_PAGES_X) * PAGE_STRIDE;
+        int oy = (slot / ATLAS_PAGES_X) * PAGE_STRIDE;
+        int mapX = ox + PAGE_GUTTER - (page % coverage.pagesX) * SplatCoverage::PAGE_SIZE;
+        int mapY = oy + PAGE_GUTTER - (page / coverage.pagesX) * SplatCoverage::PAGE_SIZE;
+        glViewport(mapX, mapY, width, height);
+
+        // aϥ~ gutter e (M dense ҦQ viewport @)
+        int sx0 = std::max(ox, mapX), sy0 = std::max(oy, mapY);
+        int sx1 = std::min(ox + PAGE_STRIDE, mapX + width), sy1 = std::min(oy + PAGE_STRIDE, mapY + height);
+        glScissor(sx0, sy0, sx1 - sx0, sy1 - sy0);
+    }
+
+    // GPU \ɭngiKϪ (splat.frag X vec4(color, 1))
+    glm::vec3 EncodeInk(int teamID, const glm::vec3& color) const {
+        if (format == InkFormat::RGBA8) return color;
+        if (teamID <= 0) return glm::vec3(0.0f);
+        if (format == InkFormat::RG8) return glm::vec3((teamID - 1) / 2.0f, 1.0f, 0.0f);
+        return glm::vec3(teamID / 3.0f, 0.0f, 0.0f);
+    }
+
+    //  CPU мgKϤW@ tile (PB Server ɥ)
+    void UploadTileFromCPU(int tile) {
+        int x, y, w, h;
+        coverage.GetTileRect(tile, x, y, w, h);
+
+        if (!sparse) {
+            UploadRegion(x, y, w, h, x, y);
+            return;
+        }
+
+        // SetTileRow itmFsFtile KۭɾF gutter ]nۧs
+        SyncPages();
+        const int P = SplatCoverage::PAGE_SIZE;
+        for (int py = std::max((y - PAGE_GUTTER) / P, 0); py <= std::min((y + h + PAGE_GUTTER - 1) / P, coverage.pagesY - 1); py++) {
+            for (int px = std::max((x - PAGE_GUTTER) / P, 0); px <= std::min((x + w + PAGE_GUTTER - 1) / P, coverage.pagesX - 1); px++) {
+                int page = py * coverage.pagesX + px;
+                if (!coverage.IsPageAllocated(page)) continue;
+
+                // o (t gutter) P tile 涰
+                int ix0 = std::max(x, px * P - PAGE_GUTTER), iy0 = std::max(y, py * P - PAGE_GUTTER);
+                int ix1 = std::min(x + w, px * P + P + PAGE_GUTTER), iy1 = std::min(y + h, py * P + P + PAGE_GUTTER);
+                if (ix0 >= ix1 || iy0 >= iy1) continue;
+
+                int ax, ay;
+                AtlasOrigin(page, ax, ay);
+                UploadRegion(ix0, iy0, ix1 - ix0, iy1 - iy0, ax + ix0 - px * P, ay + iy0 - py * P);
             }
         }
-        return false;
     }
 
-    // p
+
+    // SplatStampLibrary  maskAUb texel (originX, originY)A GPU \쪺 texel ۦP
+    // ownerID O⪺a ID (-1 = O)Aclip OiH uv d (x0, y0, x1, y1)
+    void UpdateCPUStamp(const SplatStampLibrary& library, int maskIndex, int originX, int originY, int teamID, int ownerID = -1,
+        const glm::vec4& clip = FLOOR_CLIP) {
+        const SplatStampLibrary::Mask& m = library.Get(maskIndex);
+        SetCoverageClip(clip);
+        coverage.FillMask(originX, originY, m.diameter, m.wordsPerRow, library.GetRows(m), teamID, GetOwnerSlot(ownerID));
+        coverage.ResetClip();
+    }
+
+    // neGa -> bAwidth O UV e (b| = width / 2AP GPU ѪRΪۦP)
+    void UpdateCPUStroke(const glm::vec2& a, const glm::vec2& b, int teamID, float width, int ownerID = -1, const glm::vec4& clip = FLOOR_CLIP) {
+        const float w = (float)this->width;
+        SetCoverageClip(clip);
+        coverage.FillCapsule(a.x * w, a.y * w, b.x * w, b.y * w, width * 0.5f * w, teamID, GetOwnerSlot(ownerID));
+        coverage.ResetClip();
+    }
+
+    // --- aaέp ---
+    // }ҫC texel hs 1 byte ̡AUa texel ƦbɼWq@ (Q\|^)
+    void EnableOwnerTracking() { coverage.EnableOwners(); }
+    bool IsTrackingOwners() const { return coverage.HasOwners(); }
+
+    // a ID ->  slot (1~255)AĤ@X{ɰtmFS}ҡBID < 0  slot Χɦ^ 0
+    uint8_t GetOwnerSlot(int playerID) {
+        if (!coverage.HasOwners() || playerID < 0) return 0;
+
+        auto it = ownerSlots.find(playerID);
+        if (it != ownerSlots.end()) return it->second;
+        if (slotPlayers.size() >= 255) return 0;
+
+        slotPlayers.push_back(playerID);
+        uint8_t slot = (uint8_t)slotPlayers.size();
+        ownerSlots[playerID] = slot;
+        return slot;
+    }
+
+    // aثeaϤWٯd۪ texel 
+    int64_t GetPlayerTexels(int playerID) const {
+        auto it = ownerSlots.find(playerID);
+        return (it != ownerSlots.end()) ? coverage.GetOwnerTexels(it->second) : 0;
+    }
+
+    // ҦLaa (a ID, texel )
+    void GetAllPlayerTexels(std::vector<std::pair<int, int64_t>>& out) const {
+        out.clear();
+        for (size_t i = 0; i < slotPlayers.size(); i++) {
+            out.push_back({ slotPlayers[i], coverage.GetOwnerTexels((int)i + 1) });
+        }
+    }
+
+    // eePwGˬdYӦmP radius  texel O_SwC (v texel yATC)
+    bool IsColorInArea(float u, float v, int teamID, float radius = 4.0f) const {
+        return coverage.AnyInDisc(u * width, v * width, radius, teamID);
+    }
+
+    // --- Zd (O(1)AĤ@d߮ɤ~ɺoqܰʪϰ) ---
+    // ׬@ (SplatDistanceField::CELL_SIZE  texel)AWL GetMaxInkDistance() @䤣
+
+    // }Uo texel OO team 
+    bool IsOnInk(float u, float v, int teamID) const {
+        return GetTeamAt(u, v) == teamID;
+    }
+
+    // ̪ team Z (UV )
+    float DistanceToInk(float u, float v, int teamID) {
+        if (IsOnInk(u, v, teamID)) return 0.0f;
+        inkDistance.Refresh(coverage);
+        return inkDistance.GetDistance(teamID, u * width, v * width) / width;
+    }
+
+    // radius (UV ) S team 
+    bool IsInkWithin(float u, float v, int teamID, float radius) {
+        return DistanceToInk(u, v, teamID) <= radius;
+    }
+
+    float GetMaxInkDistance() const {
+        return inkDistance.GetMaxDistance() / width;
+    }
+
+    // Dirty tile d (tile = SplatCoverage::TILE_SIZE 誺 texel)
+    uint32_t BeginPaintBatch() { return coverage.BeginBatch(); }
+    uint32_t GetVersion() const { return coverage.GetVersion(); }
+    // W@iMŮɪ version (Mŷ|C tile Цܰ)
+    // qťզa϶}lPBܡAqo version }lNnAΰe@Ū tile
+    uint32_t GetClearVersion() const { return clearVersion; }
+    void GetTilesChangedSince(uint32_t version, std::vector<int>& outTiles) const {
+        coverage.GetTilesChangedSince(version, outTiles);
+    }
+
+    int GetTeamAt(float u, float v) const {
+        return coverage.Get((int)std::floor(u * width), (int)std::floor(v * width));
+    }
+
+    // p (GPU έpAUл\v 0.0 ~ 1.0)
+    // |GoeXsέpA^ǳ̪@ GPU wG (@Is)
     glm::vec2 CalculateScore() {
-        glBindTexture(GL_TEXTURE_2D, textureID);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        // } atlas SiKϥiHέpA (T) CPU pƾ
+        if (sparse) {
+            auto cpu = CalculatePercentages();
+            return glm::vec2(cpu.first, cpu.second);
+        }
+
+        if (!histogram) histogram = new SplatHistogram(width, height);
 
-        // X̰h (1x1 )
-        int maxLevel = (int)std::floor(std::log2(std::max(width, height)));
+        histogram->Poll();
+        histogram->Submit(textureID, (int)format);
 
-        float pixelData[4];
-        glGetTexImage(GL_TEXTURE_2D, maxLevel, GL_RGBA, GL_FLOAT, pixelData);
+        const SplatHistogram::Result& result = histogram->GetLatest();
+        if (!result.valid) {
+            // GPU G٨S^ӫe CPU pƾ
+            auto cpu = CalculatePercentages();
+            return glm::vec2(cpu.first, cpu.second);
+        }
 
-        // pixelData[0] OqD`M (Team 1)
-        // pixelData[1] OqD`M (Team 2)
-        return glm::vec2(pixelData[0], pixelData[1]);
+        float totalPixels = (float)GetPaintableTexels();
+        return glm::vec2(result.teamTexels[1] / totalPixels, result.teamTexels[2] / totalPixels);
     }
 
+    // Uл\v (0.0 ~ 1.0)AŪpƾAO(1)
     std::pair<float, float> CalculatePercentages() {
-        int count1 = 0;
-        int count2 = 0;
-        int totalPixels = width * height;
-
-        for (int i = 0; i < GRID_SIZE; i++) {
-            for (int j = 0; j < GRID_SIZE; j++) {
-                if (gridData[i][j] == 1) count1++;
-                else if (gridData[i][j] == 2) count2++;
-			}
-        }
+        if (debugValidateCounters) ValidateCounters();
+
+        int64_t totalPixels = GetPaintableTexels();
 
         // קKHs
         if (totalPixels == 0) return { 0.0f, 0.0f };
 
-        return { (float)count1 / totalPixels, (float)count2 / totalPixels };
+        return { (float)coverage.GetTeamTexels(1) / totalPixels, (float)coverage.GetTeamTexels(2) / totalPixels };
+    }
+
+    // xΰϰ (UVAӨǤ) Uл\v (x = , y = )AO(1)
+    // ɹ̪ SplatZoneTable l (@O 4 texel)
+    glm::vec2 GetZoneCoverage(const glm::vec2& uvA, const glm::vec2& uvB) {
+        zoneTable.Refresh(coverage);
+
+        const int blockSize = zoneTable.blockSize;
+        const float block = (float)blockSize;
+        int bx0 = std::clamp((int)std::lround(std::min(uvA.x, uvB.x) * width / block), 0, zoneTable.blocksX);
+        int bx1 = std::clamp((int)std::lround(std::max(uvA.x, uvB.x) * width / block), 0, zoneTable.blocksX);
+        int by0 = std::clamp((int)std::lround(std::min(uvA.y, uvB.y) * width / block), 0, zoneTable.blocksY);
+        int by1 = std::clamp((int)std::lround(std::max(uvA.y, uvB.y) * width / block), 0, zoneTable.blocksY);
+
+        float area = (float)(std::min(bx1 * blockSize, width) - bx0 * blockSize) *
+                     (float)(std::min(by1 * blockSize, height) - by0 * blockSize);
+        if (area <= 0.0f) return glm::vec2(0.0f);
+
+        return glm::vec2(zoneTable.SumBlocks(1, bx0, by0, bx1, by1) / area, zoneTable.SumBlocks(2, bx0, by0, bx1, by1) / area);
+    }
+
+    int64_t GetTeamTexels(int teamID) const {
+        return coverage.GetTeamTexels(teamID);
+    }
+
+    // 0=, 1=, 2=
+    int GetWinningTeam() const {
+        int64_t t1 = coverage.GetTeamTexels(1);
+        int64_t t2 = coverage.GetTeamTexels(2);
+        if (t1 > t2) return 1;
+        if (t2 > t1) return 2;
+        return 0;
+    }
+
+    bool ValidateCounters() const {
+        if (coverage.ValidateCounters()) return true;
+
+        int64_t counts[4];
+        coverage.CountTeams(counts);
+        Logger::Warn("SplatMap counter mismatch (team or owner): T1 " + std::to_string(coverage.GetTeamTexels(1)) + " (recount " + std::to_string(counts[1]) +
+            "), T2 " + std::to_string(coverage.GetTeamTexels(2)) + " (recount " + std::to_string(counts[2]) + ")");
+        return false;
     }
 
 private:
-    void InitFBO() {
-        glGenFramebuffers(1, &fbo);
-        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    SplatHistogram* histogram = nullptr;
+    SplatDistanceField inkDistance;
+    SplatZoneTable zoneTable;
 
-        glGenTextures(1, &textureID);
-        glBindTexture(GL_TEXTURE_2D, textureID);
+    std::map<int, uint8_t> ownerSlots; // a ID -> slot
+    std::vector<int> slotPlayers;      // slot - 1 -> a ID
+    std::vector<uint8_t> uploadBuffer;
+    int64_t paintableTexels = 0;
+    uint32_t clearVersion = 0;
+
+    // uv d -> coverage  texel d (texel ߦbd򤺤~)
+    void SetCoverageClip(const glm::vec4& clip) {
+        coverage.SetClip((int)std::lround(clip.x * width), (int)std::lround(clip.y * width),
+            (int)std::lround(clip.z * width) - 1, (int)std::lround(clip.w * width) - 1);
+    }
 
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    // }Ҧ
+    int atlasPagesY = 0;                 // atlas ثeXC
+    size_t residentPages = 0;            // wgPB GPU  (= coverage tm)
+    std::vector<uint16_t> pageTableData;
+
+    unsigned int CreateInkTexture(int w, int h) const {
+        unsigned int id;
+        glGenTextures(1, &id);
+        glBindTexture(GL_TEXTURE_2D, id);
+
+        // RG8 / R8 usPл\vA RGBA8 p 2 / 4 
+        if (format == InkFormat::RG8)
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RG8, w, h, 0, GL_RG, GL_UNSIGNED_BYTE, NULL);
+        else if (format == InkFormat::R8)
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, w, h, 0, GL_RED, GL_UNSIGNED_BYTE, NULL);
+        else
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        return id;
+    }
+
+    void InitFBO() {
+        glGenFramebuffers(1, &fbo);
+
+        if (sparse) {
+            // G@@ texel
+            pageTableData.assign((size_t)coverage.pagesX * coverage.pagesY, 0);
+            glGenTextures(1, &pageTableID);
+            glBindTexture(GL_TEXTURE_2D, pageTableID);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, coverage.pagesX, coverage.pagesY, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, pageTableData.data());
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
+            textureID = 0;
+            GrowAtlas(4);
+            return;
+        }
+
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        textureID = CreateInkTexture(width, height);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureID, 0);
 
         glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
@@ -115,9 +421,96 @@ private:
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
+    // atlas j rows CA¤eƻsLh
+    void GrowAtlas(int rows) {
+        int maxSize = 0;
+        glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+        if (rows * PAGE_STRIDE > maxSize) {
+            Logger::Error("SplatMap atlas exceeds GL_MAX_TEXTURE_SIZE (" + std::to_string(maxSize) + ")");
+            rows = maxSize / PAGE_STRIDE;
+        }
+        if (rows <= atlasPagesY) return;
+
+        unsigned int newTexture = CreateInkTexture(GetAtlasWidth(), rows * PAGE_STRIDE);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, newTexture, 0);
+        glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        if (textureID) {
+            glCopyImageSubData(textureID, GL_TEXTURE_2D, 0, 0, 0, 0, newTexture, GL_TEXTURE_2D, 0, 0, 0, 0,
+                GetAtlasWidth(), GetAtlasHeight(), 1);
+            glDeleteTextures(1, &textureID);
+        }
+        textureID = newTexture;
+        atlasPagesY = rows;
+    }
+
+    // coverage stmGb atlas mBgB㭶 (t gutter) q CPU W
+    void SyncPages() {
+        if (!sparse) return;
+
+        const std::vector<int>& allocated = coverage.GetAllocatedPages();
+        if (allocated.size() < residentPages) {
+            // coverage QMŤF
+            std::fill(pageTableData.begin(), pageTableData.end(), 0);
+            glBindTexture(GL_TEXTURE_2D, pageTableID);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, coverage.pagesX, coverage.pagesY, GL_RED_INTEGER, GL_UNSIGNED_SHORT, pageTableData.data());
+            residentPages = 0;
+        }
+
+        for (; residentPages < allocated.size(); residentPages++) {
+            int page = allocated[residentPages];
+            int slot = (int)residentPages;
+            if (slot >= ATLAS_PAGES_X * atlasPagesY) GrowAtlas(atlasPagesY * 2);
+            if (slot >= ATLAS_PAGES_X * atlasPagesY) break; // atlas F
+
+            pageTableData[page] = (uint16_t)(slot + 1);
+            glBindTexture(GL_TEXTURE_2D, pageTableID);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, page % coverage.pagesX, page / coverage.pagesX, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_SHORT, &pageTableData[page]);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+            int ax, ay;
+            AtlasOrigin(page, ax, ay);
+            int px = (page % coverage.pagesX) * SplatCoverage::PAGE_SIZE;
+            int py = (page / coverage.pagesX) * SplatCoverage::PAGE_SIZE;
+            UploadRegion(px - PAGE_GUTTER, py - PAGE_GUTTER, PAGE_STRIDE, PAGE_STRIDE, ax - PAGE_GUTTER, ay - PAGE_GUTTER);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    //  CPU  (x, y, w, h) dsXgKϪ (dstX, dstY)Aaϥ~ texel @S
+    void UploadRegion(int x, int y, int w, int h, int dstX, int dstY) {
+        int channels = (format == InkFormat::RGBA8) ? 4 : (format == InkFormat::RG8) ? 2 : 1;
+        GLenum glFormat = (format == InkFormat::RGBA8) ? GL_RGBA : (format == InkFormat::RG8) ? GL_RG : GL_RED;
+
+        uploadBuffer.resize((size_t)w * h * channels);
+        for (int r = 0; r < h; r++) {
+            for (int c = 0; c < w; c++) {
+                int team = coverage.Get(x + c, y + r);
+                glm::vec3 ink = EncodeInk(team, team > 0 ? teamPalette[team - 1] : glm::vec3(0.0f));
+                uint8_t* px = &uploadBuffer[((size_t)r * w + c) * channels];
+                px[0] = (uint8_t)(ink.x * 255.0f + 0.5f);
+                if (channels >= 2) px[1] = (uint8_t)(ink.y * 255.0f + 0.5f);
+                if (channels == 4) {
+                    px[2] = (uint8_t)(ink.z * 255.0f + 0.5f);
+                    px[3] = (team > 0) ? 255 : 0;
+                }
+            }
+        }
+
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, dstX, dstY, w, h, glFormat, GL_UNSIGNED_BYTE, uploadBuffer.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
     void ClearCPUData() {
-        for (int i = 0; i < GRID_SIZE; i++)
-            for (int j = 0; j < GRID_SIZE; j++)
-                gridData[i][j] = 0;
+        coverage.Clear();
+        clearVersion = coverage.GetVersion();
     }
 };
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "SplatMap.h"
+
+// q CPU л\YXӪpa (RGBA8)AݭnŪ^ GPUA]Φhe@
+// Cӹ scale x scale  texelACOṲҲVXb`⩳W
+// u⦳ܰʪ tile \쪺AWǮɤ]ueܰʪXC
+class SplatMinimap {
+public:
+    int size;     // pa ()
+    int scale;    // CӹX texel
+
+    // mapWidth x mapHeight Oned (qaϥU}l)A@OaOAtU誺 surface atlas
+    SplatMinimap(int mapWidth, int mapHeight, int size = 128) : size(size) {
+        scale = std::max((std::max(mapWidth, mapHeight) + size - 1) / size, 1);
+        image.assign((size_t)size * size * 4, 0);
+        dirtyRowMin = 0;
+        dirtyRowMax = size - 1;
+
+        glGenTextures(1, &textureID);
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    ~SplatMinimap() {
+        glDeleteTextures(1, &textureID);
+    }
+
+    // WaϪ̷säWܰʪC (Sܮɤ򳣤)
+    void Update(const SplatMap& map) {
+        const SplatCoverage& coverage = map.coverage;
+        if (!built || coverage.GetVersion() != builtVersion) {
+            changedTiles.clear();
+            if (built) {
+                coverage.GetTilesChangedSince(builtVersion, changedTiles);
+            }
+            else {
+                for (int i = 0; i < coverage.GetTileCount(); i++) changedTiles.push_back(i);
+            }
+
+            for (int tile : changedTiles) {
+                int x, y, w, h;
+                coverage.GetTileRect(tile, x, y, w, h);
+                int px0 = x / scale, px1 = std::min((x + w - 1) / scale, size - 1);
+                int py0 = y / scale, py1 = std::min((y + h - 1) / scale, size - 1);
+                if (py0 >= size || px0 >= size) continue;
+                for (int py = py0; py <= py1; py++) {
+                    for (int px = px0; px <= px1; px++) ShadePixel(map, px, py);
+                }
+                dirtyRowMin = std::min(dirtyRowMin, py0);
+                dirtyRowMax = std::max(dirtyRowMax, py1);
+            }
+
+            built = true;
+            builtVersion = coverage.GetVersion();
+        }
+
+        lastUploadRows = 0;
+        if (dirtyRowMin > dirtyRowMax) return;
+
+        lastUploadRows = dirtyRowMax - dirtyRowMin + 1;
+        glBindTexture(GL_TEXTURE_2D, textureID);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, dirtyRowMin, size, lastUploadRows, GL_RGBA, GL_UNSIGNED_BYTE,
+            &image[(size_t)dirtyRowMin * size * 4]);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        dirtyRowMin = size;
+        dirtyRowMax = -1;
+    }
+
+    unsigned int GetTextureID() const { return textureID; }
+
+    // W@ Update WǪC (į[)
+    int GetLastUploadRows() const { return lastUploadRows; }
+
+private:
+    unsigned int textureID = 0;
+    std::vector<uint8_t> image;   //  0 C = uv.v  0 @AMKϦPV
+    std::vector<int> changedTiles;
+    bool built = false;
+    uint32_t builtVersion = 0;
+    int dirtyRowMin, dirtyRowMax;
+    int lastUploadRows = 0;
+
+    void ShadePixel(const SplatMap& map, int px, int py) {
+        const SplatCoverage& coverage = map.coverage;
+        int x0 = px * scale, x1 = std::min(x0 + scale, coverage.width);
+        int y0 = py * scale, y1 = std::min(y0 + scale, coverage.height);
+
+        int counts[3] = {};
+        for (int y = y0; y < y1; y++) {
+            for (int w = x0 / SplatCoverage::TEXELS_PER_WORD; w <= (x1 - 1) / SplatCoverage::TEXELS_PER_WORD; w++) {
+                uint64_t word = coverage.ReadWord(y, w);
+                if (!word) continue;
+
+                // o word b [x0, x1)  texel
+                int wx = w * SplatCoverage::TEXELS_PER_WORD;
+                int lo = std::max(x0 - wx, 0), hi = std::min(x1 - wx, SplatCoverage::TEXELS_PER_WORD);
+                uint64_t bits = (hi - lo == SplatCoverage::TEXELS_PER_WORD) ? ~0ull : ((1ull << ((hi - lo) * 2)) - 1);
+                uint64_t mask = (bits << (lo * 2)) & SplatCoverage::LOW_BITS;
+                for (int t = 0; t < 3; t++) {
+                    counts[t] += SplatCoverage::PopCount(SplatCoverage::MatchMask(word, SplatCoverage::Replicate(t + 1)) & mask);
+                }
+            }
+        }
+
+        float total = (float)std::max((x1 - x0) * (y1 - y0), 1);
+        glm::vec3 color(0.0f);
+        float inked = 0.0f;
+        for (int t = 0; t < 3; t++) {
+            color += map.teamPalette[t] * (counts[t] / total);
+            inked += counts[t] / total;
+        }
+        color += glm::vec3(0.12f) * (1.0f - inked); // SO`ǩ
+
+        uint8_t* p = &image[((size_t)py * size + px) * 4];
+        p[0] = (uint8_t)(color.x * 255.0f + 0.5f);
+        p[1] = (uint8_t)(color.y * 255.0f + 0.5f);
+        p[2] = (uint8_t)(color.z * 255.0f + 0.5f);
+        p[3] = 200;
+    }
+};
\ No newline at end of file
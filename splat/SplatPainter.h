@@ -3,100 +3,395 @@
 #include "../engine/rendering/Shader.h"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <vector>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+#include <cstdint>
 #include "stb_image.h"
 #include "../components/HUD.h"
 
 class SplatPainter {
+public:
+    enum class StampShape {
+        SPLAT = 0,   //  SplatStampLibrary  mask \ (splat_01.png Ϊ)
+        STROKE = 1   // n (uv -> uvEndAe = size)
+    };
+
+    // 浧 (@VƶAFlush ɤ@e)
+    struct SplatStamp {
+        glm::vec2 uv;
+        float size;
+        float rotation;
+        glm::vec3 color;
+        int teamID;
+        StampShape shape = StampShape::SPLAT;
+        glm::vec2 uvEnd = glm::vec2(0.0f);
+        int ownerID = -1; // ⪺a (-1 = O)
+        glm::vec4 clip = SplatMap::FLOOR_CLIP; // ubo uv d (x0, y0, x1, y1) 
+        int mask = -1;                         // SplatStampLibrary  mask (u SPLAT)
+        glm::ivec2 origin = glm::ivec2(0);     // mask U texel
+    };
+
+    // έpGC Flush X֤FX
+    struct FlushStats {
+        int lastFlushStamps = 0;   // W@ Flush eFX
+        int lastFlushCoalesced = 0; // W@ Flush ]Q\ӬٱX
+        int totalFlushes = 0;      // ֭p Flush  (u⦳Fne)
+        long long totalStamps = 0; // ֭p
+        long long totalCoalesced = 0;
+    };
+
 private:
     Shader* splatShader;
-    unsigned int quadVAO, quadVBO;
-    unsigned int splatTextureID;
+    unsigned int quadVAO, quadVBO, instanceVBO;
+    SplatStampLibrary stampLibrary;
+    unsigned int maskBuffer = 0, maskTexture = 0; // stampLibrary.bits  buffer texture (R32UI)
+
+    // ǵ GPU Ҹ
+    struct InstanceData {
+        glm::vec2 uv;
+        float size;
+        float rotation; // 
+        glm::vec3 color;
+        glm::vec2 stroke; // x: nqb (NDC)Ay: Ϊ (StampShape)
+        glm::vec4 clip;
+        glm::vec4 mask;   // SPLATGx, y = U texelAz = Aw = b mask buffer _I
+    };
+
+    std::vector<SplatStamp> pendingStamps;
+    std::vector<uint8_t> stampDropped;
+    std::vector<std::pair<uint32_t, int>> stampCells; // (uv l, stamp index)AƧǫ spatial hash 
+    std::vector<InstanceData> instanceData;
+    std::vector<int> drawPages;       // }aϳo Flush ne
+    size_t instanceCapacity = 0;
+    SplatMap* pendingMap = nullptr;
+    FlushStats stats;
 
 public:
     SplatPainter() {
         splatShader = new Shader("assets/shaders/splat.vert", "assets/shaders/splat.frag");
         InitQuad();
-        LoadTexture("assets/textures/splat_01.png");
+        LoadStamps("assets/textures/splat_01.png");
     }
 
     ~SplatPainter() {
         delete splatShader;
         glDeleteVertexArrays(1, &quadVAO);
         glDeleteBuffers(1, &quadVBO);
-        glDeleteTextures(1, &splatTextureID);
+        glDeleteBuffers(1, &instanceVBO);
+        glDeleteTextures(1, &maskTexture);
+        glDeleteBuffers(1, &maskBuffer);
     }
 
-    void LoadTexture(const char* path) {
-        glGenTextures(1, &splatTextureID);
-        glBindTexture(GL_TEXTURE_2D, splatTextureID);
-
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
+    //  splat KϫإߩҦjpPת maskAAWǦ buffer texture
+    void LoadStamps(const char* path) {
         int w, h, nrChannels;
         // ½ Y bA] OpenGL zyЭIbU
         stbi_set_flip_vertically_on_load(true);
         unsigned char* data = stbi_load(path, &w, &h, &nrChannels, 0);
 
         if (data) {
-            GLenum format = (nrChannels == 4) ? GL_RGBA : GL_RGB;
-            glTexImage2D(GL_TEXTURE_2D, 0, format, w, h, 0, format, GL_UNSIGNED_BYTE, data);
-            glGenerateMipmap(GL_TEXTURE_2D);
+            stampLibrary.Build(data, w, h, nrChannels);
         }
         else {
             std::cerr << "Failed to load splat texture: " << path << std::endl;
+            stampLibrary.BuildDisc();
         }
         stbi_image_free(data);
+
+        glGenBuffers(1, &maskBuffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, maskBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, stampLibrary.bits.size() * sizeof(uint32_t), stampLibrary.bits.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+        glGenTextures(1, &maskTexture);
+        glBindTexture(GL_TEXTURE_BUFFER, maskTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, maskBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
     }
 
-    void Paint(SplatMap* map, const glm::vec2& uv, float size, const glm::vec3& color, float rotation, int teamID) {
-        glBindFramebuffer(GL_FRAMEBUFFER, map->fbo);
-        glViewport(0, 0, map->width, map->height);
-        glDisable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    const SplatStampLibrary& GetStampLibrary() const { return stampLibrary; }
 
-        splatShader->Bind();
-        // --- p Model Matrix ---
-        // ڭ̪ Quad lyЬO -1  1 (e 2)
-        // ؼСGYp sizeAʨ uv mAñ
+    const FlushStats& GetStats() const { return stats; }
+    float GetAverageStampsPerFlush() const {
+        return stats.totalFlushes > 0 ? (float)stats.totalStamps / stats.totalFlushes : 0.0f;
+    }
+    size_t GetPendingCount() const { return pendingStamps.size(); }
+
+    // [JCAuøs Flush
+    // size P rotation |qƦ SplatStampLibrary ̱񪺨@šAm texel
+    // clip w]OaOFbBclWɶ SplatSurfaceAtlas::GetClipUVAWX@|Q
+    void Paint(SplatMap* map, const glm::vec2& uv, float size, const glm::vec3& color, float rotation, int teamID, int ownerID = -1,
+        const glm::vec4& clip = SplatMap::FLOOR_CLIP) {
+        // F@iaϴNªe
+        if (pendingMap && pendingMap != map) Flush();
+        pendingMap = map;
+
+        int sizeIndex = stampLibrary.SizeIndex(size * map->width);
+        int rot = SplatStampLibrary::RotationIndex(rotation);
+        const SplatStampLibrary::Mask& mask = stampLibrary.Get(sizeIndex, rot);
+
+        SplatStamp stamp = { uv, (float)mask.diameter / map->width, rot * SplatStampLibrary::ROTATION_STEP, color, teamID };
+        stamp.ownerID = ownerID;
+        stamp.clip = clip;
+        stamp.mask = sizeIndex * SplatStampLibrary::ROTATIONS + rot;
+        stamp.origin = SplatStampLibrary::Origin(uv * (float)map->width, mask.diameter);
+        pendingStamps.push_back(stamp);
+    }
 
-        glm::mat4 model = glm::mat4(1.0f);
+    // @nΪe (pgBu)AަhuO@ instance
+    // width O UV 쪺e
+    void PaintStroke(SplatMap* map, const glm::vec2& uvStart, const glm::vec2& uvEnd, float width, const glm::vec3& color, int teamID, int ownerID = -1,
+        const glm::vec4& clip = SplatMap::FLOOR_CLIP) {
+        if (pendingMap && pendingMap != map) Flush();
+        pendingMap = map;
 
-        // 1. 첾 Translate
-        // J uv O 0~1Aݭnഫ NDC y (-1 ~ 1)
-        // x: 0 -> -1, 1 -> 1  =>  x * 2 - 1
-        float ndcX = uv.x * 2.0f - 1.0f;
-        float ndcY = uv.y * 2.0f - 1.0f;
-        model = glm::translate(model, glm::vec3(ndcX, ndcY, 0.0f));
+        SplatStamp stamp = { uvStart, width, 0.0f, color, teamID };
+        stamp.shape = StampShape::STROKE;
+        stamp.uvEnd = uvEnd;
+        stamp.ownerID = ownerID;
+        stamp.clip = clip;
+        pendingStamps.push_back(stamp);
+    }
+
+    // @ FBO jw + @ Instanced Draw eV
+    void Flush() {
+        if (!pendingMap || pendingStamps.empty()) {
+            pendingMap = nullptr;
+            return;
+        }
+        SplatMap* map = pendingMap;
 
-        // 2.  Rotate (Zb)
-        model = glm::rotate(model, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
+        int coalesced = CoalesceStamps();
+
+        // ǳƹҸ
+        // nGQuad lyЬO -1  1Ab Vertex Shader  Y ->  -> 첾 uv (NDC)
+        // SPLATGQuad \b mask  texel ؤW (פwgb mask )
+        instanceData.clear();
+        instanceData.reserve(pendingStamps.size());
+        for (size_t i = 0; i < pendingStamps.size(); i++) {
+            if (stampDropped[i]) continue;
+            const SplatStamp& s = pendingStamps[i];
+            glm::vec3 ink = map->EncodeInk(s.teamID, s.color);
+            if (s.shape == StampShape::STROKE) {
+                // ߩbuqIAuuqVԪ (uv  L b NDC nOb L)
+                glm::vec2 d = s.uvEnd - s.uv;
+                float length = glm::length(d);
+                float angle = (length > 0.0f) ? std::atan2(d.y, d.x) : 0.0f;
+                instanceData.push_back({ (s.uv + s.uvEnd) * 0.5f, s.size, angle, ink, glm::vec2(length, 1.0f), s.clip, glm::vec4(0.0f) });
+            }
+            else {
+                const SplatStampLibrary::Mask& m = stampLibrary.Get(s.mask);
+                glm::vec4 mask((float)s.origin.x, (float)s.origin.y, (float)m.diameter, (float)m.offset);
+                instanceData.push_back({ s.uv, s.size, 0.0f, ink, glm::vec2(0.0f), s.clip, mask });
+            }
+        }
 
-        // 3. Y Scale
-        // l Quad e׬O 2Aڭ̧Ʊ̲פjpO size (۹ 0~1  UV Ŷ)
-        // ѩ NDC O -1~1 (2)AҥHYYƤݭnH 2 ]o줣ĪGA size wqөw
-        // o̰] size O UV Ŷjp (Ҧp 0.1 Na 10%)
-        model = glm::scale(model, glm::vec3(size, size, 1.0f));
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        if (instanceData.size() > instanceCapacity) {
+            instanceCapacity = instanceData.size() * 2;
+            glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, instanceData.size() * sizeof(InstanceData), instanceData.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-        splatShader->SetMat4("model", model);
-        splatShader->SetVec3("paintColor", color);
+        // }aϡG|Q쪺tmnAAXne (tF gutter)
+        if (map->sparse) {
+            drawPages.clear();
+            for (int pass = 0; pass < 2; pass++) {
+                if (pass == 1) {
+                    map->EnsurePagesResident(drawPages);
+                    drawPages.clear();
+                }
+                for (size_t i = 0; i < pendingStamps.size(); i++) {
+                    if (stampDropped[i]) continue;
+                    glm::vec2 c = Center(pendingStamps[i]);
+                    float r = OuterRadius(pendingStamps[i]);
+                    map->CollectPages(c - glm::vec2(r), c + glm::vec2(r), pass == 1, drawPages);
+                }
+                std::sort(drawPages.begin(), drawPages.end());
+                drawPages.erase(std::unique(drawPages.begin(), drawPages.end()), drawPages.end());
+            }
+        }
 
-        // jwKϨ Slot 0
+        glBindFramebuffer(GL_FRAMEBUFFER, map->fbo);
+        glViewport(0, 0, map->width, map->height);
+        glDisable(GL_BLEND);
+
+        splatShader->Bind();
+
+        // mask buffer j Slot 0
         glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, splatTextureID);
-        splatShader->SetInt("splatTexture", 0);
+        glBindTexture(GL_TEXTURE_BUFFER, maskTexture);
+        splatShader->SetInt("stampMasks", 0);
+        splatShader->SetVec2("uvScale", map->GetUVScale());
+        splatShader->SetVec2("mapSize", glm::vec2((float)map->width, (float)map->height));
 
         glBindVertexArray(quadVAO);
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+        if (map->sparse) {
+            // Ce@AWXoQ scissor 
+            glEnable(GL_SCISSOR_TEST);
+            for (int page : drawPages) {
+                map->SetPageViewport(page);
+                glDrawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)instanceData.size());
+            }
+            glDisable(GL_SCISSOR_TEST);
+        }
+        else {
+            glDrawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)instanceData.size());
+        }
         glBindVertexArray(0);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
-        map->UpdateCPUData(uv.x, uv.y, teamID);
+        // CPU ޿aϷӶǧs (e\eA GPU @P)
+        // P@ Flush I쪺 tile @ΦP@ version
+        map->BeginPaintBatch();
+        for (size_t i = 0; i < pendingStamps.size(); i++) {
+            if (stampDropped[i]) continue;
+            const SplatStamp& s = pendingStamps[i];
+            if (s.shape == StampShape::STROKE)
+                map->UpdateCPUStroke(s.uv, s.uvEnd, s.teamID, s.size, s.ownerID, s.clip);
+            else
+                map->UpdateCPUStamp(stampLibrary, s.mask, s.origin.x, s.origin.y, s.teamID, s.ownerID, s.clip);
+        }
+
+        stats.lastFlushStamps = (int)instanceData.size();
+        stats.lastFlushCoalesced = coalesced;
+        stats.totalFlushes++;
+        stats.totalStamps += instanceData.size();
+        stats.totalCoalesced += coalesced;
+
+        pendingStamps.clear();
+        pendingMap = nullptr;
     }
 
 private:
+    static constexpr int COALESCE_GRID = 64; // CX (uv 0~1)
+
+    // HUO pendingMap  uv  (ub Flush ̥)
+    float OuterRadius(const SplatStamp& s) const {
+        if (s.shape == StampShape::STROKE) return s.size * 0.5f + glm::length(s.uvEnd - s.uv) * 0.5f;
+        return (stampLibrary.Get(s.mask).outerRadius + 1.0f) / pendingMap->width;
+    }
+
+    float CoreRadius(const SplatStamp& s) const {
+        return stampLibrary.Get(s.mask).coreRadius / pendingMap->width;
+    }
+
+    // SPLAT ߬O mask ت ( texel ᪺m)
+    glm::vec2 Center(const SplatStamp& s) const {
+        if (s.shape == StampShape::STROKE) return (s.uv + s.uvEnd) * 0.5f;
+        float half = stampLibrary.Get(s.mask).diameter * 0.5f;
+        return (glm::vec2(s.origin) + glm::vec2(half)) / (float)pendingMap->width;
+    }
+
+    static uint32_t CellKey(int cx, int cy) {
+        return (uint32_t)(cy + 1) * (COALESCE_GRID + 2) + (uint32_t)(cx + 1);
+    }
+
+    static int ToCell(float uv) {
+        return std::max(-1, std::min(COALESCE_GRID, (int)std::floor(uv * COALESCE_GRID)));
+    }
+
+    // P@V̳Q\񤣥εeA^ǬٱX
+    // i iHᱼ (u SPLAT Ϊ)G
+    //   1. ᦳ@ j \ i ~ (޶A̫ᵲGO j)
+    //   2. ePPa k \ iAӥB k M i SOΧOHI i
+    int CoalesceStamps() {
+        size_t n = pendingStamps.size();
+        stampDropped.assign(n, 0);
+        if (n < 2) return 0;
+
+        // ̤I
+        stampCells.clear();
+        float maxCore = 0.0f;
+        float maxOuter = 0.0f;
+        for (size_t i = 0; i < n; i++) {
+            const SplatStamp& s = pendingStamps[i];
+            glm::vec2 c = Center(s);
+            stampCells.push_back({ CellKey(ToCell(c.x), ToCell(c.y)), (int)i });
+            if (s.shape == StampShape::SPLAT) maxCore = std::max(maxCore, CoreRadius(s));
+            maxOuter = std::max(maxOuter, OuterRadius(s));
+        }
+        std::sort(stampCells.begin(), stampCells.end());
+
+        int dropped = 0;
+        std::vector<int> nearby;
+        for (size_t i = 0; i < n; i++) {
+            const SplatStamp& si = pendingStamps[i];
+            if (si.shape != StampShape::SPLAT) continue;
+
+            glm::vec2 ci = Center(si);
+            float outerI = OuterRadius(si);
+
+            // |\ i θI i Aߤ@wboӽd
+            float reach = std::max(maxCore, outerI + maxOuter);
+            QueryCells(ci, reach, nearby);
+
+            bool covered = false;
+            int bestEarlier = -1;
+            for (int j : nearby) {
+                if (j == (int)i || stampDropped[j]) continue;
+                const SplatStamp& sj = pendingStamps[j];
+                if (sj.shape != StampShape::SPLAT) continue;
+                if (!Covers(sj, si)) continue;
+
+                if (j > (int)i) { covered = true; break; }
+                if (SameInk(sj, si)) bestEarlier = std::max(bestEarlier, j);
+            }
+
+            if (!covered && bestEarlier >= 0) {
+                covered = true;
+                for (int m : nearby) {
+                    if (m <= bestEarlier || m >= (int)i || stampDropped[m]) continue;
+                    const SplatStamp& sm = pendingStamps[m];
+                    if (SameInk(sm, si)) continue;
+                    float reachM = OuterRadius(sm) + outerI;
+                    glm::vec2 d = Center(sm) - ci;
+                    if (glm::dot(d, d) < reachM * reachM) { covered = false; break; }
+                }
+            }
+
+            if (covered) {
+                stampDropped[i] = 1;
+                dropped++;
+            }
+        }
+        return dropped;
+    }
+
+    // \WhG@ (P̳ۦP)
+    static bool SameInk(const SplatStamp& a, const SplatStamp& b) {
+        return a.teamID == b.teamID && a.ownerID == b.ownerID;
+    }
+
+    // outer O_] inner ~ (d򤣦PɤAQinO inner 쪺a)
+    // ~O mask ڪ texel ZAҥHPwOT
+    bool Covers(const SplatStamp& outer, const SplatStamp& inner) const {
+        if (outer.clip != inner.clip) return false;
+
+        // @Ҥ@˪\ (P@ maskBP@Ӧm)
+        if (outer.mask == inner.mask && outer.origin == inner.origin) return true;
+
+        glm::vec2 d = (Center(outer) - Center(inner)) * (float)pendingMap->width;
+        return std::sqrt(glm::dot(d, d)) + stampLibrary.Get(inner.mask).outerRadius < stampLibrary.Get(outer.mask).coreRadius;
+    }
+
+    void QueryCells(const glm::vec2& center, float radius, std::vector<int>& out) const {
+        out.clear();
+        int x0 = ToCell(center.x - radius), x1 = ToCell(center.x + radius);
+        int y0 = ToCell(center.y - radius), y1 = ToCell(center.y + radius);
+        for (int cy = y0; cy <= y1; cy++) {
+            for (int cx = x0; cx <= x1; cx++) {
+                auto range = std::equal_range(stampCells.begin(), stampCells.end(), std::make_pair(CellKey(cx, cy), 0),
+                    [](const std::pair<uint32_t, int>& a, const std::pair<uint32_t, int>& b) { return a.first < b.first; });
+                for (auto it = range.first; it != range.second; ++it) out.push_back(it->second);
+            }
+        }
+    }
+
     void InitQuad() {
         float quadVertices[] = {
             // positions   // texCoords
@@ -121,6 +416,37 @@ private:
         glEnableVertexAttribArray(1);
         glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 5 * sizeof(float), (void*)(3 * sizeof(float)));
 
+        // Instance VBO (m 2 ~ 6)Ajpb Flush ɨ̻ݨD
+        glGenBuffers(1, &instanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+        instanceCapacity = 64;
+        glBufferData(GL_ARRAY_BUFFER, instanceCapacity * sizeof(InstanceData), nullptr, GL_DYNAMIC_DRAW);
+
+        // uv + size + rotation (Vec4)
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)0);
+        glVertexAttribDivisor(2, 1);
+
+        // Color (Vec3)
+        glEnableVertexAttribArray(3);
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, color)));
+        glVertexAttribDivisor(3, 1);
+
+        // Stroke (Vec2)
+        glEnableVertexAttribArray(4);
+        glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, stroke)));
+        glVertexAttribDivisor(4, 1);
+
+        // Clip (Vec4)
+        glEnableVertexAttribArray(5);
+        glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, clip)));
+        glVertexAttribDivisor(5, 1);
+
+        // Mask (Vec4)
+        glEnableVertexAttribArray(6);
+        glVertexAttribPointer(6, 4, GL_FLOAT, GL_FALSE, sizeof(InstanceData), (void*)(offsetof(InstanceData, mask)));
+        glVertexAttribDivisor(6, 1);
+
         glBindVertexArray(0);
     }
 };
\ No newline at end of file
@@ -22,9 +22,13 @@ public:
             return { false, glm::vec2(0.0f) };
         }
 
-        float u = (dx + halfW) / width;
-        float v = 1.0f - ((dz + halfD) / depth);
+        return { true, WorldToUVUnbounded(worldPos, floorPos, width, depth) };
+    }
 
-        return { true, glm::vec2(u, v) };
+    // ˬd (WXaO|o 0~1 H~ uvAeI)
+    static glm::vec2 WorldToUVUnbounded(const glm::vec3& worldPos, const glm::vec3& floorPos, float width, float depth) {
+        float u = (worldPos.x - floorPos.x + width / 2.0f) / width;
+        float v = 1.0f - ((worldPos.z - floorPos.z + depth / 2.0f) / depth);
+        return glm::vec2(u, v);
     }
 };
\ No newline at end of file
@@ -2,15 +2,42 @@
 #include "SplatMap.h"
 #include "../engine/rendering/Shader.h"
 #include "../scene/FloorMesh.h"
+#include <vector>
 
 class SplatRenderer {
 public:
     static void RenderFloor(Shader& shader, FloorMesh* floor, SplatMap* map) {
+        BindInk(shader, map);
+        floor->Draw(shader);
+        shader.SetInt("useInk", 0);
+    }
+
+    // 牆壁、箱子這些可以塗的表面 (mesh 的 uv 指向墨水地圖的 surface atlas)
+    static void RenderSurfaces(Shader& shader, const std::vector<Entity*>& surfaces, SplatMap* map) {
+        BindInk(shader, map);
+        for (auto s : surfaces) s->Draw(shader);
+        shader.SetInt("useInk", 0);
+    }
+
+private:
+    static void BindInk(Shader& shader, SplatMap* map) {
         map->BindTexture(1);
         shader.SetInt("inkMap", 1);
         shader.SetInt("useInk", 1);
+        shader.SetInt("inkFormat", (int)map->format);
+        shader.SetVec2("inkUVScale", map->GetUVScale());
+        shader.SetVec3("teamColors[0]", map->teamPalette[0]);
+        shader.SetVec3("teamColors[1]", map->teamPalette[1]);
+        shader.SetVec3("teamColors[2]", map->teamPalette[2]);
 
-        floor->Draw(shader);
-        shader.SetInt("useInk", 0);
+        shader.SetInt("inkSparse", map->sparse ? 1 : 0);
+        if (map->sparse) {
+            map->BindPageTable(2);
+            shader.SetInt("inkPageTable", 2);
+            shader.SetInt("inkPageSize", SplatCoverage::PAGE_SIZE);
+            shader.SetInt("inkPageGutter", SplatMap::PAGE_GUTTER);
+            shader.SetInt("inkAtlasPagesX", SplatMap::ATLAS_PAGES_X);
+            shader.SetVec2("inkMapSize", glm::vec2(map->width, map->height));
+        }
     }
 };
\ No newline at end of file
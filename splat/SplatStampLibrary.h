@@ -0,0 +1,161 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "SplatCoverage.h"
+
+// wnΪGXؤjp x XبסAC texel 1 bit
+// GPU \ (splat.frag q buffer texture Ū) M CPU л\ (SplatCoverage::FillMask) ŪOP@ bitA
+// \m] texelAҥH쪺 texel @ˡAAݭnn
+//
+// jpH texel A 2^(1/4) żƱq MIN_DIAMETER  MAX_DIAMETER (WLγ̤j@)
+// ׶qƦ ROTATIONS ءAάdNC\ sin / cos
+class SplatStampLibrary {
+public:
+    static constexpr int MIN_DIAMETER = 8;
+    static constexpr int MAX_DIAMETER = 512;
+    static constexpr int STEPS_PER_OCTAVE = 4;
+    static constexpr int ROTATIONS = 16;
+    static constexpr float ROTATION_STEP = 360.0f / ROTATIONS; // 
+
+    struct Mask {
+        int diameter;      //  (texel)AΪb diameter x diameter ظ
+        int wordsPerRow;   // CCX uint32 (bit i = oC i  texel)
+        uint32_t offset;   // b bits ̪_I
+        float coreRadius;  // ߨ̪@ӡuSvtexel Z (texel)AoH@w
+        float outerRadius; // ߨ̻@ӡuvtexel Z (texel)AoH~@wS
+    };
+
+    std::vector<int> diameters;  // C@Ū
+    std::vector<Mask> masks;     // [sizeIndex * ROTATIONS + rotation]
+    std::vector<uint32_t> bits;  // Ҧ mask ̧ǱƦC (ѤUW@C@C)AWǦ GPU  buffer texture
+
+    // q RGBA / RGB Ϥ alpha إ ( 0 C = ϤUtA stbi_set_flip_vertically_on_load(true) @)
+    // alpha >= 0.5 a⦳AS alpha ϤάqD
+    void Build(const unsigned char* pixels, int w, int h, int channels) {
+        int alphaChannel = (channels == 4) ? 3 : 0;
+        BuildMasks([&](float u, float v) { return SampleImage(pixels, w, h, channels, alphaChannel, u, v) >= 0.5f; });
+    }
+
+    // SϤɪƮסGb| radius (۹إbe) ߶
+    void BuildDisc(float radius = SplatCoverage::SPLAT_SHAPE_RADIUS) {
+        BuildMasks([&](float u, float v) {
+            float x = u * 2.0f - 1.0f, y = v * 2.0f - 1.0f;
+            return x * x + y * y <= radius * radius;
+        });
+    }
+
+    bool IsBuilt() const { return !masks.empty(); }
+    int GetSizeCount() const { return (int)diameters.size(); }
+
+    // ̱ diameter (texel) @ (HҺ)
+    int SizeIndex(float diameter) const {
+        if (diameter <= (float)diameters.front()) return 0;
+        if (diameter >= (float)diameters.back()) return (int)diameters.size() - 1;
+        int i = (int)std::lround(std::log2(diameter / MIN_DIAMETER) * STEPS_PER_OCTAVE);
+        return std::clamp(i, 0, (int)diameters.size() - 1);
+    }
+
+    //  () -> ̱񪺶qƨ׽s
+    static int RotationIndex(float degrees) {
+        int r = (int)std::lround(degrees / ROTATION_STEP) % ROTATIONS;
+        return (r < 0) ? r + ROTATIONS : r;
+    }
+
+    // ̸IMwਤ ()AP@ӦmbCxW@ˡAN rand() % 360
+    static float RotationFromPosition(const glm::vec2& uv) {
+        uint32_t x = (uint32_t)(int32_t)std::floor(uv.x * 8192.0f);
+        uint32_t y = (uint32_t)(int32_t)std::floor(uv.y * 8192.0f);
+        uint32_t h = x * 0x9E3779B1u ^ (y + 0x7F4A7C15u) * 0x85EBCA77u;
+        h ^= h >> 16; h *= 0x7FEB352Du;
+        h ^= h >> 15; h *= 0x846CA68Bu;
+        h ^= h >> 16;
+        return (h % ROTATIONS) * ROTATION_STEP;
+    }
+
+    const Mask& Get(int sizeIndex, int rotation) const { return masks[sizeIndex * ROTATIONS + rotation]; }
+    const Mask& Get(int maskIndex) const { return masks[maskIndex]; }
+    const uint32_t* GetRows(const Mask& m) const { return bits.data() + m.offset; }
+
+    // ؤ (x, y) o texel S
+    bool Test(const Mask& m, int x, int y) const {
+        if (x < 0 || y < 0 || x >= m.diameter || y >= m.diameter) return false;
+        return (bits[m.offset + (size_t)y * m.wordsPerRow + x / 32] >> (x % 32)) & 1u;
+    }
+
+    // \U texelGGPU M CPU γoӦmA = origin + diameter / 2
+    static glm::ivec2 Origin(const glm::vec2& texelCenter, int diameter) {
+        return glm::ivec2((int)std::floor(texelCenter.x - diameter * 0.5f + 0.5f),
+                          (int)std::floor(texelCenter.y - diameter * 0.5f + 0.5f));
+    }
+
+private:
+    // inside(u, v)G઺Ϊb [0,1]^2  (u, v) S
+    template <typename Inside>
+    void BuildMasks(Inside inside) {
+        diameters.clear();
+        masks.clear();
+        bits.clear();
+
+        for (int i = 0;; i++) {
+            int d = (int)std::lround(MIN_DIAMETER * std::exp2((float)i / STEPS_PER_OCTAVE));
+            if (d > MAX_DIAMETER) break;
+            if (!diameters.empty() && d == diameters.back()) continue;
+            diameters.push_back(d);
+        }
+
+        for (int d : diameters) {
+            for (int r = 0; r < ROTATIONS; r++) {
+                float angle = glm::radians(r * ROTATION_STEP);
+                float c = std::cos(angle), s = std::sin(angle);
+
+                Mask m;
+                m.diameter = d;
+                m.wordsPerRow = (d + 31) / 32;
+                m.offset = (uint32_t)bits.size();
+                bits.resize(bits.size() + (size_t)m.wordsPerRow * d, 0u);
+
+                // C texel ^઺yЦA (إ~@ߨS)
+                float half = d * 0.5f;
+                float core = half, outer = 0.0f;
+                for (int y = 0; y < d; y++) {
+                    for (int x = 0; x < d; x++) {
+                        float px = (x + 0.5f - half) / half, py = (y + 0.5f - half) / half;
+                        float lx = c * px + s * py, ly = -s * px + c * py;
+                        bool set = std::abs(lx) <= 1.0f && std::abs(ly) <= 1.0f && inside(lx * 0.5f + 0.5f, ly * 0.5f + 0.5f);
+
+                        float dist = std::sqrt(px * px + py * py) * half;
+                        if (set) {
+                            bits[m.offset + (size_t)y * m.wordsPerRow + x / 32] |= 1u << (x % 32);
+                            outer = std::max(outer, dist);
+                        }
+                        else {
+                            core = std::min(core, dist);
+                        }
+                    }
+                }
+                m.coreRadius = core;
+                m.outerRadius = outer;
+                masks.push_back(m);
+            }
+        }
+    }
+
+    // uʤ (쥻 GPU ˶KϪG)
+    static float SampleImage(const unsigned char* pixels, int w, int h, int channels, int channel, float u, float v) {
+        float fx = u * w - 0.5f, fy = v * h - 0.5f;
+        int x0 = (int)std::floor(fx), y0 = (int)std::floor(fy);
+        float tx = fx - x0, ty = fy - y0;
+
+        auto at = [&](int x, int y) {
+            x = std::clamp(x, 0, w - 1);
+            y = std::clamp(y, 0, h - 1);
+            return pixels[((size_t)y * w + x) * channels + channel] / 255.0f;
+        };
+        float a = at(x0, y0) + (at(x0 + 1, y0) - at(x0, y0)) * tx;
+        float b = at(x0, y0 + 1) + (at(x0 + 1, y0 + 1) - at(x0, y0 + 1)) * tx;
+        return a + (b - a) * ty;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include "SplatCoverage.h"
+
+// ̥iH (clUB𤺰) uƦbaϦaOU誺C
+// aO [0, floorSize) CAatlas q floorSize + FLOOR_MARGIN C}lA̰ױƦ@h@h (shelf packing)
+// Ҧ texel K׳aO@ˡAҥHP@ size b@@ˤj
+//
+// uv GxBy Haϼe׬ 1 (aO = [0,1]^2Aatlas b v > 1 a)
+class SplatSurfaceAtlas {
+public:
+    static constexpr int FACE_GUTTER = 2;                        // PŴX texel (uʤ|Vj)
+    static constexpr int FLOOR_MARGIN = SplatCoverage::TILE_SIZE; // aOP atlas Ť@ tile
+
+    struct Face {
+        glm::vec3 origin;        // @ (@ɮy)
+        glm::vec3 axisU, axisV;  // uۭӳVqAnormal = cross(axisU, axisV)
+        glm::vec3 normal;
+        glm::vec2 size;          // 
+        int texelX, texelY;      // baϤWϰ (U)
+        int texelW, texelH;
+    };
+
+    std::vector<Face> faces;
+
+    // floorSize: aO texel  (= aϼe)AmetersPerFloor: aO
+    void Reset(int floorSize, float metersPerFloor) {
+        faces.clear();
+        mapWidth = floorSize;
+        texelsPerMeter = floorSize / metersPerFloor;
+        shelfX = 0;
+        shelfY = floorSize + FLOOR_MARGIN;
+        shelfH = 0;
+    }
+
+    // [J@ӯxέA^ǭs (񤣤Uaϼe׮ɦ^ -1)
+    int AddFace(const glm::vec3& origin, const glm::vec3& axisU, const glm::vec3& axisV, const glm::vec2& size) {
+        int w = std::max((int)std::ceil(size.x * texelsPerMeter), 1);
+        int h = std::max((int)std::ceil(size.y * texelsPerMeter), 1);
+        if (w > mapWidth) return -1;
+
+        // o@h񤣤UN}s@h (jubPAKat)
+        if (shelfX + w > mapWidth) {
+            shelfY += shelfH;
+            shelfX = 0;
+            shelfH = 0;
+        }
+
+        Face f;
+        f.origin = origin;
+        f.axisU = glm::normalize(axisU);
+        f.axisV = glm::normalize(axisV);
+        f.normal = glm::normalize(glm::cross(f.axisU, f.axisV));
+        f.size = size;
+        f.texelX = shelfX;
+        f.texelY = shelfY;
+        f.texelW = w;
+        f.texelH = h;
+        faces.push_back(f);
+
+        shelfX += w + FACE_GUTTER;
+        shelfH = std::max(shelfH, h + FACE_GUTTER);
+        return (int)faces.size() - 1;
+    }
+
+    // atlas Ψ쪺C (taO)A tile
+    int GetRows() const {
+        if (faces.empty()) return 0;
+        int end = shelfY + shelfH;
+        int rows = end - mapWidth;
+        return (rows + SplatCoverage::TILE_SIZE - 1) / SplatCoverage::TILE_SIZE * SplatCoverage::TILE_SIZE;
+    }
+
+    // Ҧ[_Ӫ texel  (pn[Wo)
+    int64_t GetFaceTexels() const {
+        int64_t total = 0;
+        for (const Face& f : faces) total += (int64_t)f.texelW * f.texelH;
+        return total;
+    }
+
+    // W () y -> a uv
+    glm::vec2 LocalToUV(int face, const glm::vec2& local) const {
+        const Face& f = faces[face];
+        return glm::vec2(f.texelX + local.x * texelsPerMeter, f.texelY + local.y * texelsPerMeter) / (float)mapWidth;
+    }
+
+    glm::vec2 WorldToUV(int face, const glm::vec3& p) const {
+        const Face& f = faces[face];
+        glm::vec3 d = p - f.origin;
+        return LocalToUV(face, glm::vec2(glm::dot(d, f.axisU), glm::dot(d, f.axisV)));
+    }
+
+    // o@baϤW uv d (x0, y0, x1, y1)A\ubo̭
+    glm::vec4 GetClipUV(int face) const {
+        const Face& f = faces[face];
+        return glm::vec4(f.texelX, f.texelY, f.texelX + f.texelW, f.texelY + f.texelH) / (float)mapWidth;
+    }
+
+private:
+    int mapWidth = 1;
+    float texelsPerMeter = 1.0f;
+    int shelfX = 0, shelfY = 0, shelfH = 0;
+};
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include "SplatCoverage.h"
+
+// U summed-area tableANxΰϰ쪺U texel ƳO O(1)
+// H blockSize x blockSize  texel @֥[ (d߽d|l)
+// u SplatCoverage ܰʪ tile lpơASAT q̥Wܰʮ橹kUɺ
+class SplatZoneTable {
+public:
+    static constexpr int MIN_BLOCK_SIZE = 4;
+    static constexpr int MAX_BLOCKS = 512;   // jaϧlj (̦h@ word e)AjpTwb 512^2 k
+    static constexpr int TEAM_COUNT = 2;
+
+    int blockSize;
+    int blocksX, blocksY;
+
+    SplatZoneTable(int texWidth, int texHeight) {
+        blockSize = MIN_BLOCK_SIZE;
+        while (blockSize < SplatCoverage::TEXELS_PER_WORD && std::max(texWidth, texHeight) > blockSize * MAX_BLOCKS) blockSize *= 2;
+
+        blocksX = (texWidth + blockSize - 1) / blockSize;
+        blocksY = (texHeight + blockSize - 1) / blockSize;
+        for (int t = 0; t < TEAM_COUNT; t++) {
+            blockCounts[t].assign((size_t)blocksX * blocksY, 0);
+            sums[t].assign((size_t)(blocksX + 1) * (blocksY + 1), 0);
+        }
+    }
+
+    // W coverage ̷s (Sܮɤ򳣤)
+    void Refresh(const SplatCoverage& coverage) {
+        if (built && coverage.GetVersion() == builtVersion) return;
+
+        const int blocksPerTile = SplatCoverage::TILE_SIZE / blockSize;
+        changedTiles.clear();
+        if (built) {
+            coverage.GetTilesChangedSince(builtVersion, changedTiles);
+        }
+        else {
+            for (int i = 0; i < coverage.GetTileCount(); i++) changedTiles.push_back(i);
+        }
+
+        int minX = blocksX, minY = blocksY;
+        for (int tile : changedTiles) {
+            int bx0 = (tile % coverage.tilesX) * blocksPerTile;
+            int by0 = (tile / coverage.tilesX) * blocksPerTile;
+            for (int by = by0; by < std::min(by0 + blocksPerTile, blocksY); by++) {
+                for (int bx = bx0; bx < std::min(bx0 + blocksPerTile, blocksX); bx++) {
+                    CountBlock(coverage, bx, by);
+                }
+            }
+            minX = std::min(minX, bx0);
+            minY = std::min(minY, by0);
+        }
+
+        // ܰʮlPW誺 SAT ȤvT
+        if (minX < blocksX && minY < blocksY) {
+            for (int t = 0; t < TEAM_COUNT; t++) RebuildSums(t, minX, minY);
+        }
+
+        built = true;
+        builtVersion = coverage.GetVersion();
+    }
+
+    // ly [bx0, bx1) x [by0, by1)  team  texel 
+    int64_t SumBlocks(int team, int bx0, int by0, int bx1, int by1) const {
+        if (team < 1 || team > TEAM_COUNT) return 0;
+        bx0 = std::clamp(bx0, 0, blocksX); bx1 = std::clamp(bx1, 0, blocksX);
+        by0 = std::clamp(by0, 0, blocksY); by1 = std::clamp(by1, 0, blocksY);
+        if (bx0 >= bx1 || by0 >= by1) return 0;
+
+        const std::vector<int32_t>& s = sums[team - 1];
+        const int stride = blocksX + 1;
+        return (int64_t)s[(size_t)by1 * stride + bx1] - s[(size_t)by0 * stride + bx1]
+             - s[(size_t)by1 * stride + bx0] + s[(size_t)by0 * stride + bx0];
+    }
+
+private:
+    std::vector<uint16_t> blockCounts[TEAM_COUNT];
+    std::vector<int32_t> sums[TEAM_COUNT];   // (blocksX + 1) x (blocksY + 1)A 0 C /  0
+    std::vector<int> changedTiles;
+    bool built = false;
+    uint32_t builtVersion = 0;
+
+    void CountBlock(const SplatCoverage& coverage, int bx, int by) {
+        int x = bx * blockSize;
+        int shift = (x % SplatCoverage::TEXELS_PER_WORD) * 2;
+        uint64_t bits = (blockSize == SplatCoverage::TEXELS_PER_WORD) ? ~0ull : ((1ull << (blockSize * 2)) - 1);
+        uint64_t blockMask = (bits << shift) & SplatCoverage::LOW_BITS;
+        int w = x / SplatCoverage::TEXELS_PER_WORD;
+
+        int counts[TEAM_COUNT] = {};
+        int yEnd = std::min((by + 1) * blockSize, coverage.height);
+        for (int y = by * blockSize; y < yEnd; y++) {
+            uint64_t word = coverage.ReadWord(y, w);
+            for (int t = 0; t < TEAM_COUNT; t++) {
+                counts[t] += SplatCoverage::PopCount(SplatCoverage::MatchMask(word, SplatCoverage::Replicate(t + 1)) & blockMask);
+            }
+        }
+
+        size_t index = (size_t)by * blocksX + bx;
+        for (int t = 0; t < TEAM_COUNT; t++) blockCounts[t][index] = (uint16_t)counts[t];
+    }
+
+    void RebuildSums(int t, int minX, int minY) {
+        const uint16_t* c = blockCounts[t].data();
+        int32_t* s = sums[t].data();
+        const int stride = blocksX + 1;
+
+        for (int by = minY; by < blocksY; by++) {
+            int32_t* row = s + (size_t)(by + 1) * stride;
+            const int32_t* up = row - stride;
+            for (int bx = minX; bx < blocksX; bx++) {
+                row[bx + 1] = c[(size_t)by * blocksX + bx] + row[bx] + up[bx + 1] - up[bx];
+            }
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+
+// dįզ@Ϊd (HeightFieldBench / LevelBVHBench)
+// cl Level::CreateBox \XӪthAP@ seed 䮳쪺cl@
+namespace BenchLevel {
+
+const float MAP_SIZE = 80.0f;
+const size_t WALLS = 4; // MakeBoxes(withWalls = true) ɫe 4 ӬO
+
+struct Box {
+    glm::vec3 min, max;
+
+    glm::vec3 Center() const { return (min + max) * 0.5f; }
+    glm::vec3 HalfSize() const { return (max - min) * 0.5f; }
+};
+
+inline std::vector<Box> MakeBoxes(int count, std::mt19937& rng, bool withWalls) {
+    // l 0.5 mAjp 0.5 ~ 4 m ()A 1 ~ 4 mAKa
+    std::uniform_int_distribution<int> cell(-76, 76), size(1, 8), height(2, 8);
+    std::vector<Box> boxes;
+    if (withWalls) {
+        float half = MAP_SIZE / 2.0f, wallH = 5.0f;
+        boxes.push_back({ { -half, 0.0f, -half - 1.0f }, { half, wallH, -half } });
+        boxes.push_back({ { -half, 0.0f, half }, { half, wallH, half + 1.0f } });
+        boxes.push_back({ { -half - 1.0f, 0.0f, -half }, { -half, wallH, half } });
+        boxes.push_back({ { half, 0.0f, -half }, { half + 1.0f, wallH, half } });
+    }
+    for (int i = 0; i < count; i++) {
+        glm::vec3 scale(size(rng) * 0.5f, height(rng) * 0.5f, size(rng) * 0.5f);
+        glm::vec3 corner(cell(rng) * 0.5f, 0.0f, cell(rng) * 0.5f);
+        boxes.push_back({ corner, corner + scale });
+    }
+    return boxes;
+}
+
+// C@մժGnӲդ@ˡG@դ@ˡAӵ{N^ 1
+class MismatchCounter {
+public:
+    // ^ǭnbo@տX᭱аO
+    const char* Check(int wrong) {
+        if (wrong > 0) failedRuns++;
+        return wrong > 0 ? "  MISMATCH" : "";
+    }
+
+    int ExitCode() const {
+        if (failedRuns) std::printf("%d run(s) did not match the reference\n", failedRuns);
+        return failedRuns ? 1 : 0;
+    }
+
+private:
+    int failedRuns = 0;
+};
+
+} // namespace BenchLevel
\ No newline at end of file
@@ -0,0 +1,131 @@
+// pg / u raycast G쥻gk vs MHn HeightField
+// 쥻GC 1 m @BAC@BIs@ GetHeightAt (uʱLҦê AABB)
+// {bGHeightField::Raycast ul DDAAGetHeightAt ŪҦbl
+// êƶq (5 / 50 / 500 ӽcl) }Ft~ 1 cm BѦҵˬdؼgkRm
+// ׬d () nuʱy@ˡA@˴N^ 1
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../scene/HeightField.h"
+#include "BenchLevel.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+using BenchLevel::Box;
+using BenchLevel::MAP_SIZE;
+using BenchLevel::WALLS;
+
+const float LASER_LENGTH = 60.0f;
+
+// 쥻 Level::GetHeightAt @˪uʱy (令TclݡAcl|ɨ̰)
+// first = WALLS ɸ쥻@ˤݳ (׬d)FRaycast Ѧҵױq 0 }lA]n
+float LinearHeightAt(const std::vector<Box>& boxes, float x, float z, size_t first = 0) {
+    float h = 0.0f;
+    for (size_t i = first; i < boxes.size(); i++) {
+        const Box& b = boxes[i];
+        if (x >= b.min.x && x <= b.max.x && z >= b.min.z && z <= b.max.z) {
+            h = std::max(h, b.max.y);
+        }
+    }
+    return h;
+}
+
+// 쥻 TriggerLaserBeam @ˡGTwBA^Ǽ쪺Z (S = maxDist)
+float SteppedRaycast(const std::vector<Box>& boxes, glm::vec3 start, glm::vec3 dir, float maxDist, float step) {
+    glm::vec3 p = start;
+    for (float d = 0; d < maxDist; d += step) {
+        p += dir * step;
+        if (LinearHeightAt(boxes, p.x, p.z) > p.y) return d + step;
+    }
+    return maxDist;
+}
+
+struct Ray {
+    glm::vec3 start, dir;
+};
+
+std::vector<Ray> MakeRays(int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> xz(-MAP_SIZE * 0.45f, MAP_SIZE * 0.45f), angle(0.0f, 6.2831853f), pitch(-0.15f, 0.05f);
+    std::vector<Ray> rays;
+    for (int i = 0; i < count; i++) {
+        float a = angle(rng);
+        rays.push_back({ glm::vec3(xz(rng), 1.5f, xz(rng)), glm::normalize(glm::vec3(std::cos(a), pitch(rng), std::sin(a))) });
+    }
+    return rays;
+}
+
+} // namespace
+
+int main() {
+    const int RAYS = 2000;
+    const int HEIGHT_QUERIES = 200000;
+    std::mt19937 rng(42);
+
+    BenchLevel::MismatchCounter mismatches;
+    std::printf("%-7s %14s %14s %9s %14s %14s %9s %12s %12s %10s\n", "boxes", "stepped us/ray", "DDA us/ray", "speedup",
+        "linear ns/h", "cell ns/h", "speedup", "stepped err", "DDA err", "height err");
+
+    for (int count : { 5, 50, 500 }) {
+        std::vector<Box> boxes = BenchLevel::MakeBoxes(count, rng, true);
+        std::vector<Ray> rays = MakeRays(RAYS, rng);
+
+        auto bakeStart = Clock::now();
+        HeightField field;
+        float half = MAP_SIZE / 2.0f + 1.25f;
+        field.Reset(glm::vec2(-half), glm::vec2(half), 0.25f);
+        for (size_t i = 0; i < boxes.size(); i++) field.AddBox(boxes[i].Center(), boxes[i].HalfSize(), i >= WALLS);
+        double bakeMs = std::chrono::duration<double, std::milli>(Clock::now() - bakeStart).count();
+
+        volatile float sink = 0.0f;
+
+        auto t0 = Clock::now();
+        std::vector<float> stepped(RAYS);
+        for (int i = 0; i < RAYS; i++) stepped[i] = SteppedRaycast(boxes, rays[i].start, rays[i].dir, LASER_LENGTH, 1.0f);
+        double steppedUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / RAYS;
+
+        t0 = Clock::now();
+        std::vector<float> dda(RAYS);
+        for (int i = 0; i < RAYS; i++) {
+            float t;
+            dda[i] = field.Raycast(rays[i].start, rays[i].start + rays[i].dir * LASER_LENGTH, t) ? t * LASER_LENGTH : LASER_LENGTH;
+        }
+        double ddaUs = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / RAYS;
+
+        std::uniform_real_distribution<float> xz(-MAP_SIZE * 0.5f, MAP_SIZE * 0.5f);
+        std::vector<glm::vec2> points(HEIGHT_QUERIES);
+        for (auto& p : points) p = glm::vec2(xz(rng), xz(rng));
+
+        t0 = Clock::now();
+        for (const auto& p : points) sink = sink + LinearHeightAt(boxes, p.x, p.y, WALLS);
+        double linearNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / HEIGHT_QUERIES;
+
+        t0 = Clock::now();
+        for (const auto& p : points) sink = sink + field.GetHeightAt(p.x, p.y);
+        double cellNs = std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / HEIGHT_QUERIES;
+
+        int heightWrong = 0;
+        for (const auto& p : points) {
+            if (LinearHeightAt(boxes, p.x, p.y, WALLS) != field.GetHeightAt(p.x, p.y)) heightWrong++;
+        }
+
+        // ѦҵסG1 cm B (ue 200 )AέpRZtWL 5 cm 
+        int steppedWrong = 0, ddaWrong = 0, checked = 200;
+        for (int i = 0; i < checked; i++) {
+            float ref = SteppedRaycast(boxes, rays[i].start, rays[i].dir, LASER_LENGTH, 0.01f);
+            if (std::abs(stepped[i] - ref) > 0.05f) steppedWrong++;
+            if (std::abs(dda[i] - ref) > 0.05f) ddaWrong++;
+        }
+
+        std::printf("%-7d %14.2f %14.2f %8.1fx %14.1f %14.1f %8.1fx %11.1f%% %11.1f%% %10d   (bake %.2f ms)%s\n", count,
+            steppedUs, ddaUs, steppedUs / ddaUs, linearNs, cellNs, linearNs / cellNs,
+            100.0 * steppedWrong / checked, 100.0 * ddaWrong / checked, heightWrong, bakeMs,
+            mismatches.Check(heightWrong));
+    }
+    return mismatches.ExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+// ludIGCluuʱLҦcl vs LevelBVH d
+// clƶq (10 / 100 / 1000 / 10000 ) }AluTw@U (C@B = 25 m/s x 1/30 s)
+// 䳣Ρucl~X radiusvkA쪺clM t n@ˡA@˴N^ 1
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../scene/LevelBVH.h"
+#include "BenchLevel.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+using BenchLevel::MAP_SIZE;
+
+const float STEP_LENGTH = 25.0f / 30.0f;
+const int SWEEPS = 10000;
+const int FRAMES = 20;
+
+std::vector<LevelBVH::Box> MakeBoxes(int count, std::mt19937& rng) {
+    std::vector<LevelBVH::Box> boxes;
+    for (const BenchLevel::Box& b : BenchLevel::MakeBoxes(count, rng, false)) boxes.push_back({ b.min, b.max });
+    return boxes;
+}
+
+std::vector<LevelBVH::SweepQuery> MakeSweeps(int count, std::mt19937& rng) {
+    std::uniform_real_distribution<float> xz(-MAP_SIZE * 0.5f, MAP_SIZE * 0.5f), h(0.2f, 4.0f), angle(0.0f, 6.2831853f),
+        pitch(-0.5f, 0.3f), radius(0.1f, 0.4f);
+    std::vector<LevelBVH::SweepQuery> sweeps;
+    for (int i = 0; i < count; i++) {
+        float a = angle(rng);
+        glm::vec3 from(xz(rng), h(rng), xz(rng));
+        glm::vec3 dir = glm::normalize(glm::vec3(std::cos(a), pitch(rng), std::sin(a)));
+        sweeps.push_back({ from, from + dir * STEP_LENGTH, radius(rng) });
+    }
+    return sweeps;
+}
+
+// ӲաGCӽcl@Xj AABB (slab)A̦
+LevelBVH::Hit LinearSweep(const std::vector<LevelBVH::Box>& boxes, const LevelBVH::SweepQuery& q) {
+    LevelBVH::Hit hit;
+    glm::vec3 d = q.to - q.from;
+    for (int b = 0; b < (int)boxes.size(); b++) {
+        glm::vec3 lo = boxes[b].min - q.radius, hi = boxes[b].max + q.radius;
+        float tEnter = 0.0f, tExit = hit.t;
+        bool miss = false;
+        for (int i = 0; i < 3 && !miss; i++) {
+            if (std::abs(d[i]) <= 1e-12f) {
+                miss = q.from[i] < lo[i] || q.from[i] > hi[i];
+                continue;
+            }
+            float t0 = (lo[i] - q.from[i]) / d[i], t1 = (hi[i] - q.from[i]) / d[i];
+            if (t0 > t1) std::swap(t0, t1);
+            tEnter = std::max(tEnter, t0);
+            tExit = std::min(tExit, t1);
+            miss = tEnter > tExit;
+        }
+        if (!miss && (hit.box < 0 || tEnter < hit.t)) {
+            hit.box = b;
+            hit.t = tEnter;
+        }
+    }
+    return hit;
+}
+
+} // namespace
+
+int main() {
+    std::mt19937 rng(42);
+    BenchLevel::MismatchCounter mismatches;
+
+    std::printf("%-7s %16s %16s %9s %9s %10s\n", "boxes", "linear ms/frame", "BVH ms/frame", "speedup", "hits", "build ms");
+    for (int count : { 10, 100, 1000, 10000 }) {
+        std::vector<LevelBVH::Box> boxes = MakeBoxes(count, rng);
+        std::vector<LevelBVH::SweepQuery> sweeps = MakeSweeps(SWEEPS, rng);
+
+        auto t0 = Clock::now();
+        LevelBVH bvh;
+        bvh.Build(boxes);
+        double buildMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+        // ӲիܺCզXֶ]XV
+        int linearFrames = std::max(1, std::min(FRAMES, 2000 / count));
+        std::vector<LevelBVH::Hit> linear(SWEEPS);
+        t0 = Clock::now();
+        for (int f = 0; f < linearFrames; f++) {
+            for (int i = 0; i < SWEEPS; i++) linear[i] = LinearSweep(boxes, sweeps[i]);
+        }
+        double linearMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / linearFrames;
+
+        std::vector<LevelBVH::Hit> hits;
+        t0 = Clock::now();
+        for (int f = 0; f < FRAMES; f++) bvh.SweepSpheres(sweeps, hits);
+        double bvhMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count() / FRAMES;
+
+        // cl|ɦP@ t iOPclA t Nn
+        int hitCount = 0, wrong = 0;
+        for (int i = 0; i < SWEEPS; i++) {
+            bool a = linear[i].box >= 0, b = hits[i].box >= 0;
+            if (b) hitCount++;
+            if (a != b || (a && std::abs(linear[i].t - hits[i].t) > 1e-5f)) wrong++;
+        }
+
+        std::printf("%-7d %16.3f %16.3f %8.1fx %9d %10.3f%s\n", count, linearMs, bvhMs, linearMs / bvhMs, hitCount, buildMs,
+            mismatches.Check(wrong));
+    }
+    return mismatches.ExitCode();
+}
\ No newline at end of file
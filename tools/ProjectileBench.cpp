@@ -0,0 +1,175 @@
+// ProjectileSystem sG1k / 10k / 100k Pɦb
+// C@VGn -> Xalu -> ɷslu (sƺ N)
+// ӲլO쥻gkGClu@ heap  (Transform t~tm)BCV LookAt PԦB vector::erase 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../gameplay/ProjectileSystem.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Spawner {
+    std::mt19937 rng{ 7 };
+    std::uniform_real_distribution<float> unit{ 0.0f, 1.0f };
+
+    void Next(glm::vec3& pos, glm::vec3& vel) {
+        pos = glm::vec3(unit(rng) * 80.0f - 40.0f, 1.0f + unit(rng) * 2.0f, unit(rng) * 80.0f - 40.0f);
+        float angle = unit(rng) * 6.2831853f;
+        float speed = 20.0f + unit(rng) * 10.0f;
+        vel = glm::vec3(std::cos(angle) * speed, 2.0f, std::sin(angle) * speed);
+    }
+
+    // @}lNwgF@qɶ (0 ~ 0.3 )AĤ@VNOíwAA|ҦluPɸa
+    void NextInFlight(glm::vec3& pos, glm::vec3& vel) {
+        Next(pos, vel);
+        float age = unit(rng) * 0.3f;
+        pos += vel * age;
+        pos.y -= 0.5f * ProjectileSystem::GRAVITY * age * age;
+        vel.y -= ProjectileSystem::GRAVITY * age;
+    }
+};
+
+// --- 쥻ưtm (Projectile : Entity) ---
+struct LegacyTransform {
+    glm::vec3 position{ 0.0f }, rotation{ 0.0f }, scale{ 1.0f };
+};
+
+struct LegacyProjectile {
+    std::string name = "Projectile";
+    std::unique_ptr<LegacyTransform> transform = std::make_unique<LegacyTransform>();
+    std::vector<std::unique_ptr<int>> components;
+    glm::vec3 velocity, inkColor{ 1.0f, 0.0f, 0.0f };
+    int ownerTeam = 1, ownerID = 0;
+    bool isDead = false, hasHitFloor = false;
+    glm::vec3 hitPosition{ 0.0f };
+
+    void UpdatePhysics(float dt) {
+        velocity.y -= 30.0f * dt;
+        LegacyTransform& t = *transform;
+        t.position += velocity * dt;
+        t.rotation.x += 720.0f * dt;
+        t.rotation.z += 360.0f * dt;
+
+        // UpdateVisualDeformation + Transform::LookAt
+        float speed = glm::length(velocity);
+        if (speed > 0.1f) {
+            glm::vec3 d = velocity / speed;
+            t.rotation.y = glm::degrees(std::atan2(d.x, d.z));
+            t.rotation.x = glm::degrees(-std::asin(d.y));
+        }
+        float stretch = 1.0f + speed * 0.1f;
+        float squash = 1.0f / std::sqrt(stretch);
+        t.scale = glm::vec3(0.3f * squash, 0.3f * squash, 0.3f * stretch);
+
+        if (t.position.y <= 0.0f) {
+            float overshoot = (std::abs(velocity.y) > 0.001f) ? t.position.y / velocity.y : 0.0f;
+            t.position -= velocity * overshoot;
+            t.position.y = 0.0f;
+            hasHitFloor = true;
+            hitPosition = t.position;
+            isDead = true;
+        }
+    }
+};
+
+struct Result {
+    double frameMs;
+    long long removed;
+};
+
+Result RunLegacy(int count, int frames, float dt) {
+    Spawner spawner;
+    std::vector<std::unique_ptr<LegacyProjectile>> list;
+    auto spawn = [&](bool inFlight) {
+        auto p = std::make_unique<LegacyProjectile>();
+        if (inFlight) spawner.NextInFlight(p->transform->position, p->velocity);
+        else spawner.Next(p->transform->position, p->velocity);
+        list.push_back(std::move(p));
+    };
+    for (int i = 0; i < count; i++) spawn(true);
+
+    long long removed = 0;
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        int died = 0;
+        for (auto it = list.begin(); it != list.end(); ) {
+            (*it)->UpdatePhysics(dt);
+            if ((*it)->isDead) {
+                it = list.erase(it);
+                died++;
+            }
+            else {
+                ++it;
+            }
+        }
+        for (int i = 0; i < died; i++) spawn(false);
+        removed += died;
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return { ms / frames, removed };
+}
+
+Result RunSystem(int count, int frames, float dt, bool simd) {
+    Spawner spawner;
+    ProjectileSystem system;
+    system.Reserve(count);
+    auto spawn = [&](bool inFlight) {
+        glm::vec3 pos, vel;
+        if (inFlight) spawner.NextInFlight(pos, vel);
+        else spawner.Next(pos, vel);
+        system.Spawn(pos, vel, glm::vec3(1.0f, 0.0f, 0.0f), 1, 0.3f, 0);
+    };
+    for (int i = 0; i < count; i++) spawn(true);
+
+    long long removed = 0;
+    volatile float sink = 0.0f;
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        if (simd) system.Integrate(dt);
+        else system.IntegrateScalar(0, system.Size(), dt);
+
+        int died = 0;
+        size_t i = 0;
+        while (i < system.Size()) {
+            if (system.ResolveFloorHit(i)) {
+                sink = sink + system.GetWidth(i); // aɤ~ݭnԦ᪺jp (a)
+                system.Remove(i);
+                died++;
+                continue;
+            }
+            i++;
+        }
+        for (int k = 0; k < died; k++) spawn(false);
+        removed += died;
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return { ms / frames, removed };
+}
+
+} // namespace
+
+int main() {
+    const float dt = 1.0f / 60.0f;
+    std::printf("%-10s %16s %16s %16s %10s\n", "live", "legacy ms/frame", "SoA scalar", "SoA SIMD", "speedup");
+    for (int count : { 1000, 10000, 100000 }) {
+        // vector::erase O O(n)AjƶqɹӲեu]֤@IV
+        int frames = 600;
+        int legacyFrames = std::max(20, 600 * 1000 / count);
+
+        Result legacy = RunLegacy(count, legacyFrames, dt);
+        Result scalar = RunSystem(count, frames, dt, false);
+        Result simd = RunSystem(count, frames, dt, true);
+        std::printf("%-10d %16.3f %16.3f %16.3f %9.1fx   (removed/frame %.0f)\n", count,
+            legacy.frameMs, scalar.frameMs, simd.frameMs, legacy.frameMs / simd.frameMs, (double)simd.removed / frames);
+    }
+    return 0;
+}
\ No newline at end of file
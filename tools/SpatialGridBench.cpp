@@ -0,0 +1,119 @@
+// SpatialGrid RPwGƶqluƶq}վ
+// C@VGخl -> Clud@y ( GameWorld::UpdateProjectiles @) -> XDpgdn
+// ӲլO쥻gkGCluLҦ (O(lu x ))
+// XӪRƭn@ˡA@˴N^ 1
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <glm/glm.hpp>
+
+#include "../gameplay/SpatialGrid.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const float ARENA = 80.0f;
+const float BODY_RADIUS = 0.5f;
+const float BULLET_RADIUS = 0.15f;
+const float LASER_RADIUS = 3.0f;
+const float LASER_LENGTH = 60.0f;
+const int LASERS_PER_FRAME = 4;
+
+struct Scene {
+    std::vector<glm::vec3> bodies;   // 餤
+    std::vector<glm::vec3> bullets;
+    std::vector<glm::vec3> laserA, laserB;
+};
+
+Scene MakeScene(int entities, int bullets, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> xz(-ARENA * 0.5f, ARENA * 0.5f), h(0.0f, 3.0f), angle(0.0f, 6.2831853f);
+    Scene s;
+    for (int i = 0; i < entities; i++) s.bodies.push_back(glm::vec3(xz(rng), 1.0f, xz(rng)));
+    for (int i = 0; i < bullets; i++) s.bullets.push_back(glm::vec3(xz(rng), h(rng), xz(rng)));
+    for (int i = 0; i < LASERS_PER_FRAME; i++) {
+        glm::vec3 a(xz(rng), 1.5f, xz(rng));
+        float t = angle(rng);
+        s.laserA.push_back(a);
+        s.laserB.push_back(a + glm::vec3(std::cos(t), 0.0f, std::sin(t)) * LASER_LENGTH);
+    }
+    return s;
+}
+
+float SegmentDistance(const glm::vec3& p, const glm::vec3& a, const glm::vec3& b) {
+    glm::vec3 ab = b - a;
+    float t = glm::clamp(glm::dot(p - a, ab) / glm::dot(ab, ab), 0.0f, 1.0f);
+    return glm::distance(p, a + ab * t);
+}
+
+struct Result {
+    double frameMs;
+    long long hits;
+};
+
+Result RunBrute(const Scene& s, int frames) {
+    long long hits = 0;
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (const glm::vec3& p : s.bullets) {
+            for (const glm::vec3& c : s.bodies) {
+                if (glm::distance(p, c) < BODY_RADIUS + BULLET_RADIUS) hits++;
+            }
+        }
+        for (int l = 0; l < LASERS_PER_FRAME; l++) {
+            for (const glm::vec3& c : s.bodies) {
+                if (SegmentDistance(c, s.laserA[l], s.laserB[l]) < BODY_RADIUS + LASER_RADIUS) hits++;
+            }
+        }
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return { ms / frames, hits / frames };
+}
+
+Result RunGrid(const Scene& s, int frames) {
+    SpatialGrid<int> grid;
+    std::vector<int> found;
+    long long hits = 0;
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) {
+        grid.Clear();
+        for (size_t i = 0; i < s.bodies.size(); i++) grid.Insert((int)i, s.bodies[i], BODY_RADIUS);
+        grid.Build();
+
+        for (const glm::vec3& p : s.bullets) {
+            grid.QuerySphere(p, BULLET_RADIUS, found);
+            hits += (long long)found.size();
+        }
+        for (int l = 0; l < LASERS_PER_FRAME; l++) {
+            grid.QueryCapsule(s.laserA[l], s.laserB[l], LASER_RADIUS, found);
+            hits += (long long)found.size();
+        }
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return { ms / frames, hits / frames };
+}
+
+} // namespace
+
+int main() {
+    int failures = 0;
+    std::printf("%-10s %-10s %14s %14s %9s %10s\n", "entities", "bullets", "brute ms/frame", "grid ms/frame", "speedup", "hits");
+    for (int entities : { 8, 64, 512, 4096 }) {
+        for (int bullets : { 1000, 10000, 100000 }) {
+            Scene scene = MakeScene(entities, bullets, 1234u);
+            // ӲիܺCզXֶ]XV
+            long long work = (long long)entities * bullets;
+            int frames = (int)std::max(5LL, std::min(200LL, 400000000LL / std::max(1LL, work)));
+
+            Result brute = RunBrute(scene, frames);
+            Result grid = RunGrid(scene, frames);
+            bool ok = brute.hits == grid.hits;
+            if (!ok) failures++;
+            std::printf("%-10d %-10d %14.3f %14.3f %8.1fx %10lld%s\n", entities, bullets,
+                brute.frameMs, grid.frameMs, brute.frameMs / grid.frameMs, grid.hits, ok ? "" : "  MISMATCH");
+        }
+    }
+    return failures ? 1 : 0;
+}
\ No newline at end of file
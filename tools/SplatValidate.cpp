@@ -0,0 +1,385 @@
+// GPU K vs CPU SplatCoverage @Pˬd
+// @վ (ɮשH) Pɵei SplatMap  GPU KϻP CPU л\ϡAŪ^Kϳv texel 
+// ^Uл\v~tB@P texel ƻPӮɡF@PWL --max-mismatch ɦ^ 1AiHӾ SplatPainter ק
+// SPLAT ΪŪP@ maskAӧ@PFnOU۸ѪRpAnbW texel i]BI~ttX
+//
+// SùiHγn GL ]AҦpG
+//   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./SplatValidate --random 5000
+//   ./SplatValidate --headless --random 5000   (GLFW 3.4 + OSMesaAݭn X)
+//
+// ɮ榡 (@@A# }YO)G
+//   s u v size rotation team owner [x0 y0 x1 y1]      SplatPainter::Paint
+//   l u0 v0 u1 v1 width team owner [x0 y0 x1 y1]      SplatPainter::PaintStroke
+//   f                                                 Flush (SܨC --batch  Flush @)
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../splat/SplatMap.h"
+#include "../splat/SplatPainter.h"
+
+namespace {
+
+struct Command {
+    char type;   // 's', 'l', 'f'
+    glm::vec2 a, b;
+    float size = 0.0f, rotation = 0.0f;
+    int team = 1, owner = -1;
+    glm::vec4 clip = SplatMap::FLOOR_CLIP;
+};
+
+struct Options {
+    int width = 1024, height = 1024;
+    InkFormat format = InkFormat::R8;
+    bool sparse = false;
+    bool headless = false;
+    int randomCount = 0;
+    unsigned seed = 1;
+    int batch = 64;
+    std::string stampFile, recordFile;
+    long long maxMismatch = -1; // -1 = aϪ 0.001%
+};
+
+using Clock = std::chrono::steady_clock;
+
+double Ms(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double, std::milli>(b - a).count();
+}
+
+bool LoadCommands(const std::string& path, std::vector<Command>& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        Command c;
+        ss >> c.type;
+        if (c.type == 's') ss >> c.a.x >> c.a.y >> c.size >> c.rotation >> c.team >> c.owner;
+        else if (c.type == 'l') ss >> c.a.x >> c.a.y >> c.b.x >> c.b.y >> c.size >> c.team >> c.owner;
+        else if (c.type != 'f') continue;
+
+        glm::vec4 clip;
+        if (ss >> clip.x >> clip.y >> clip.z >> clip.w) c.clip = clip;
+        out.push_back(c);
+    }
+    return true;
+}
+
+void SaveCommands(const std::string& path, const std::vector<Command>& cmds) {
+    std::ofstream out(path);
+    out << "# SplatValidate stamps\n";
+    for (const Command& c : cmds) {
+        if (c.type == 's') out << "s " << c.a.x << ' ' << c.a.y << ' ' << c.size << ' ' << c.rotation << ' ' << c.team << ' ' << c.owner;
+        else if (c.type == 'l') out << "l " << c.a.x << ' ' << c.a.y << ' ' << c.b.x << ' ' << c.b.y << ' ' << c.size << ' ' << c.team << ' ' << c.owner;
+        else out << 'f';
+        if (c.type != 'f' && c.clip != SplatMap::FLOOR_CLIP) out << ' ' << c.clip.x << ' ' << c.clip.y << ' ' << c.clip.z << ' ' << c.clip.w;
+        out << '\n';
+    }
+}
+
+// C̮thGjhOlujpAeM`ɪj
+void GenerateCommands(int count, unsigned seed, int batch, std::vector<Command>& out) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> uv(-0.02f, 1.02f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    for (int i = 0; i < count; i++) {
+        Command c;
+        float kind = unit(rng);
+        c.team = 1 + (int)(rng() % 2);
+        c.owner = (int)(rng() % 4);
+        c.a = glm::vec2(uv(rng), uv(rng));
+        if (kind < 0.15f) {
+            c.type = 'l';
+            c.b = c.a + (glm::vec2(unit(rng), unit(rng)) - 0.5f) * 0.2f;
+            c.size = 0.005f + unit(rng) * 0.02f;
+        }
+        else {
+            c.type = 's';
+            c.size = (kind > 0.97f) ? 0.05f + unit(rng) * 0.1f : 0.01f + unit(rng) * 0.04f;
+            c.rotation = unit(rng) * 360.0f;
+        }
+        out.push_back(c);
+        if ((i + 1) % batch == 0) out.push_back({ 'f' });
+    }
+}
+
+int DecodeTeam(const SplatMap& map, const uint8_t* p) {
+    switch (map.format) {
+    case InkFormat::R8:
+        return (int)(p[0] * 3 + 127) / 255;
+    case InkFormat::RG8:
+        return (p[1] < 128) ? 0 : 1 + (p[0] * 2 + 127) / 255;
+    default: {
+        if (p[3] < 128) return 0;
+        // ̱񪺶C
+        int best = 0, bestDist = 1 << 30;
+        for (int t = 0; t < 3; t++) {
+            int d = 0;
+            for (int k = 0; k < 3; k++) {
+                int diff = p[k] - (int)(map.teamPalette[t][k] * 255.0f + 0.5f);
+                d += diff * diff;
+            }
+            if (d < bestDist) { bestDist = d; best = t + 1; }
+        }
+        return best;
+    }
+    }
+}
+
+// Ū^iK (}ҦŪ atlas)A^ǨC texel qD
+int ReadInkTexture(const SplatMap& map, std::vector<uint8_t>& pixels, int& texW, int& texH) {
+    int channels = (map.format == InkFormat::RGBA8) ? 4 : (map.format == InkFormat::RG8) ? 2 : 1;
+    GLenum glFormat = (map.format == InkFormat::RGBA8) ? GL_RGBA : (map.format == InkFormat::RG8) ? GL_RG : GL_RED;
+
+    glBindTexture(GL_TEXTURE_2D, map.textureID);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &texW);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &texH);
+    pixels.assign((size_t)texW * texH * channels, 0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    if (texW > 0 && texH > 0) glGetTexImage(GL_TEXTURE_2D, 0, glFormat, GL_UNSIGNED_BYTE, pixels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return channels;
+}
+
+void PrintUsage() {
+    std::printf(
+        "usage: SplatValidate [options]\n"
+        "  --stamps FILE       replay stamps from FILE\n"
+        "  --random N          generate N random stamps (default 2000 when no file is given)\n"
+        "  --seed S            random seed (default 1)\n"
+        "  --batch N           stamps per Flush when the input has no 'f' lines (default 64)\n"
+        "  --record FILE       write the stamps that were used to FILE\n"
+        "  --size W [H]        ink map size in texels (default 1024)\n"
+        "  --format r8|rg8|rgba8\n"
+        "  --sparse            paged ink map (GPU atlas + page table)\n"
+        "  --headless          GLFW null platform + OSMesa context\n"
+        "  --max-mismatch N    exit with 1 when more than N texels disagree (default 0.001%% of the map)\n");
+}
+
+bool ParseArgs(int argc, char** argv, Options& o) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return (i + 1 < argc) ? argv[++i] : ""; };
+        if (arg == "--stamps") o.stampFile = next();
+        else if (arg == "--random") o.randomCount = std::atoi(next());
+        else if (arg == "--seed") o.seed = (unsigned)std::strtoul(next(), nullptr, 10);
+        else if (arg == "--batch") o.batch = std::max(std::atoi(next()), 1);
+        else if (arg == "--record") o.recordFile = next();
+        else if (arg == "--size") {
+            o.width = o.height = std::atoi(next());
+            if (i + 1 < argc && argv[i + 1][0] != '-') o.height = std::atoi(next());
+        }
+        else if (arg == "--format") {
+            std::string f = next();
+            if (f == "r8") o.format = InkFormat::R8;
+            else if (f == "rg8") o.format = InkFormat::RG8;
+            else if (f == "rgba8") o.format = InkFormat::RGBA8;
+            else return false;
+        }
+        else if (arg == "--sparse") o.sparse = true;
+        else if (arg == "--headless") o.headless = true;
+        else if (arg == "--max-mismatch") o.maxMismatch = std::atoll(next());
+        else return false;
+    }
+    if (o.width <= 0 || o.height <= 0) return false;
+    if (o.stampFile.empty() && o.randomCount <= 0) o.randomCount = 2000;
+    return true;
+}
+
+GLFWwindow* CreateContext(bool headless) {
+    if (headless) {
+#ifdef GLFW_PLATFORM_NULL
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#endif
+    }
+    if (!glfwInit()) return nullptr;
+
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    if (headless) glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+
+    GLFWwindow* window = glfwCreateWindow(64, 64, "SplatValidate", NULL, NULL);
+    if (!window) return nullptr;
+    glfwMakeContextCurrent(window);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        glfwDestroyWindow(window);
+        return nullptr;
+    }
+    return window;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!ParseArgs(argc, argv, opt)) {
+        PrintUsage();
+        return 2;
+    }
+
+    std::vector<Command> cmds;
+    if (!opt.stampFile.empty() && !LoadCommands(opt.stampFile, cmds)) {
+        Logger::Error("Failed to read stamps: " + opt.stampFile);
+        return 2;
+    }
+    if (opt.randomCount > 0) GenerateCommands(opt.randomCount, opt.seed, opt.batch, cmds);
+    if (!opt.recordFile.empty()) SaveCommands(opt.recordFile, cmds);
+
+    GLFWwindow* window = CreateContext(opt.headless);
+    if (!window) {
+        Logger::Error("Failed to create an OpenGL 4.5 context");
+        glfwTerminate();
+        return 2;
+    }
+    Logger::Log(std::string("GL_RENDERER: ") + (const char*)glGetString(GL_RENDERER));
+
+    int exitCode = 0;
+    {
+        SplatMap map(opt.width, opt.height, opt.format, opt.sparse);
+        SplatPainter painter;
+        const SplatStampLibrary& library = painter.GetStampLibrary();
+
+        // u] CPU ݥ]ƪӲ (P˪qƻPǡAΨӶq CPU Ӯ)
+        SplatCoverage cpuOnly(opt.width, opt.height);
+        cpuOnly.Clear();
+
+        GLuint query;
+        glGenQueries(1, &query);
+        double flushMs = 0.0, gpuMs = 0.0, cpuOnlyMs = 0.0;
+        int flushes = 0, stamps = 0, sinceFlush = 0;
+
+        auto flush = [&]() {
+            if (painter.GetPendingCount() == 0) return;
+            glBeginQuery(GL_TIME_ELAPSED, query);
+            auto t0 = Clock::now();
+            painter.Flush();
+            auto t1 = Clock::now();
+            glEndQuery(GL_TIME_ELAPSED);
+            GLuint64 ns = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+            flushMs += Ms(t0, t1);
+            gpuMs += ns / 1.0e6;
+            flushes++;
+            sinceFlush = 0;
+        };
+
+        for (const Command& c : cmds) {
+            if (c.type == 'f') { flush(); continue; }
+
+            glm::vec3 color = map.teamPalette[std::clamp(c.team, 1, 3) - 1];
+            if (c.type == 's') painter.Paint(&map, c.a, c.size, color, c.rotation, c.team, c.owner, c.clip);
+            else painter.PaintStroke(&map, c.a, c.b, c.size, color, c.team, c.owner, c.clip);
+
+            //  SplatMap::UpdateCPUStamp / UpdateCPUStroke @˪P]
+            const float w = (float)opt.width;
+            auto t0 = Clock::now();
+            cpuOnly.SetClip((int)std::lround(c.clip.x * w), (int)std::lround(c.clip.y * w),
+                (int)std::lround(c.clip.z * w) - 1, (int)std::lround(c.clip.w * w) - 1);
+            if (c.type == 's') {
+                int sizeIndex = library.SizeIndex(c.size * w);
+                int rot = SplatStampLibrary::RotationIndex(c.rotation);
+                const SplatStampLibrary::Mask& m = library.Get(sizeIndex, rot);
+                glm::ivec2 origin = SplatStampLibrary::Origin(c.a * w, m.diameter);
+                cpuOnly.FillMask(origin.x, origin.y, m.diameter, m.wordsPerRow, library.GetRows(m), c.team);
+            }
+            else {
+                cpuOnly.FillCapsule(c.a.x * w, c.a.y * w, c.b.x * w, c.b.y * w, c.size * 0.5f * w, c.team);
+            }
+            cpuOnly.ResetClip();
+            cpuOnlyMs += Ms(t0, Clock::now());
+            stamps++;
+            if (++sinceFlush >= opt.batch) flush();
+        }
+        flush();
+        glFinish();
+        glDeleteQueries(1, &query);
+
+        // Ū^ GPU K
+        auto r0 = Clock::now();
+        std::vector<uint8_t> pixels;
+        int texW = 0, texH = 0;
+        int channels = ReadInkTexture(map, pixels, texW, texH);
+        double readbackMs = Ms(r0, Clock::now());
+
+        // v texel 
+        long long gpuTexels[4] = {}, cpuTexels[4] = {}, confusion[4][4] = {};
+        long long mismatched = 0;
+        int firstBadX = -1, firstBadY = -1;
+        for (int y = 0; y < opt.height; y++) {
+            for (int x = 0; x < opt.width; x++) {
+                int cpu = map.coverage.Get(x, y);
+                int gpu = 0;
+                if (!opt.sparse) {
+                    gpu = DecodeTeam(map, &pixels[((size_t)y * texW + x) * channels]);
+                }
+                else {
+                    int page = map.coverage.PageOf(x, y);
+                    if (map.coverage.GetPageSlot(page) >= 0) {
+                        int ax, ay;
+                        map.AtlasOrigin(page, ax, ay);
+                        ax += x % SplatCoverage::PAGE_SIZE;
+                        ay += y % SplatCoverage::PAGE_SIZE;
+                        if (ax < texW && ay < texH) gpu = DecodeTeam(map, &pixels[((size_t)ay * texW + ax) * channels]);
+                    }
+                }
+                gpu = std::clamp(gpu, 0, 3);
+                gpuTexels[gpu]++;
+                cpuTexels[cpu]++;
+                confusion[cpu][gpu]++;
+                if (cpu != gpu) {
+                    if (mismatched == 0) { firstBadX = x; firstBadY = y; }
+                    mismatched++;
+                }
+            }
+        }
+
+        long long cpuOnlyMismatched = 0;
+        for (int y = 0; y < opt.height; y++) {
+            for (int x = 0; x < opt.width; x++) cpuOnlyMismatched += (cpuOnly.Get(x, y) != map.coverage.Get(x, y));
+        }
+
+        const double total = (double)opt.width * opt.height;
+        std::printf("map %dx%d  format %s  %s\n", opt.width, opt.height,
+            opt.format == InkFormat::R8 ? "R8" : opt.format == InkFormat::RG8 ? "RG8" : "RGBA8", opt.sparse ? "sparse" : "dense");
+        std::printf("stamps %d  flushes %d  coalesced %lld\n", stamps, flushes, painter.GetStats().totalCoalesced);
+        for (int t = 1; t <= 2; t++) {
+            std::printf("team %d  cpu %.4f%%  gpu %.4f%%  error %+.4f%%  (%lld texels)\n", t,
+                100.0 * cpuTexels[t] / total, 100.0 * gpuTexels[t] / total,
+                100.0 * (gpuTexels[t] - cpuTexels[t]) / total, gpuTexels[t] - cpuTexels[t]);
+        }
+        std::printf("mismatched texels %lld (%.4f%%)", mismatched, 100.0 * mismatched / total);
+        if (mismatched > 0) std::printf("  first at (%d, %d)", firstBadX, firstBadY);
+        std::printf("\n");
+        std::printf("  cpu\\gpu      none       red     green\n");
+        for (int c = 0; c < 3; c++) {
+            std::printf("  %-6s %9lld %9lld %9lld\n", c == 0 ? "none" : c == 1 ? "red" : "green",
+                confusion[c][0], confusion[c][1], confusion[c][2]);
+        }
+        std::printf("cpu-only replay differs from painter CPU data: %lld texels\n", cpuOnlyMismatched);
+        std::printf("time  flush %.2f ms (cpu side)  gpu %.2f ms  cpu raster only %.2f ms  readback %.2f ms\n",
+            flushMs, gpuMs, cpuOnlyMs, readbackMs);
+
+        long long allowed = (opt.maxMismatch >= 0) ? opt.maxMismatch : (long long)(total / 100000.0);
+        if (mismatched > allowed) {
+            Logger::Error("GPU and CPU coverage diverge: " + std::to_string(mismatched) + " texels");
+            exitCode = 1;
+        }
+    }
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return exitCode;
+}
\ No newline at end of file